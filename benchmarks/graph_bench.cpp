@@ -0,0 +1,358 @@
+/*
+  Benchmarks of the Graph operations on the graphs of generators.h (R-MAT,
+  Erdos-Renyi, Barabasi-Albert, Watts-Strogatz, random geometric and a
+  road like grid) at several scales (2^scale vertices), and on the metro
+  network of examples/metro_net.h.
+
+  Every measurement is the median of some repetitions, printed as a table
+  with its throughput and, with --json, written as JSON to compare the
+  results of two commits.
+
+    g++ -std=c++11 -O2 -pthread benchmarks/graph_bench.cpp -o graph_bench
+    ./graph_bench --scale 10 --scale 14 --repetitions 5 --json results.json
+
+  Options:
+    --scale N        log2 of the vertices of the generated graphs, it can be
+                     given several times (8, 10 and 12 by default)
+    --repetitions R  runs of every measurement, 3 by default
+    --filter TEXT    only the benchmarks whose name contains TEXT
+    --seed S         seed of the generators, 42 by default
+    --json FILE      also writes the results to FILE
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "../include/graph.h"
+#include "../include/graph_builder.h"
+#include "../include/adjacency_snapshot.h"
+#include "../include/generators.h"
+#include "../examples/metro_net.h"
+
+using namespace std;
+using namespace easy_graphs;
+
+namespace {
+
+struct Options {
+  vector<unsigned> scales;
+  unsigned repetitions = 3;
+  string filter;
+  uint64_t seed = 42;
+  string json;
+};
+
+// Undirected weighted graph given by its edges, vertices 0 .. vertices - 1
+struct EdgeList {
+  string name;
+  unsigned scale;
+  size_t vertices;
+  vector<tuple<int, int, int>> edges;
+};
+
+struct Result {
+  string benchmark;
+  string graph;
+  unsigned scale;
+  size_t vertices;
+  size_t edges;
+  double seconds; // median
+  double items;
+  string unit;
+};
+
+// Graphs above these sizes skip the benchmarks whose cost is quadratic:
+// newVertex and newEdge search the vertices, and the full animation
+// frames hold the whole graph each
+const size_t MAX_INGEST_VERTICES = 1 << 13;
+const size_t MAX_ANIMATION_VERTICES = 1 << 8;
+const size_t POINT_TO_POINT_QUERIES = 32;
+const int MAX_WEIGHT = 100;
+
+// Results of the operations, printed so they are not optimized away
+size_t checksum = 0;
+
+// ------------------------- generators -------------------------
+
+// All the generated graphs have about 8 edges per vertex
+
+RmatGenerator rmat(unsigned scale) { return RmatGenerator(scale, 8); }
+
+ErdosRenyiGenerator erdosRenyi(unsigned scale) {
+  return ErdosRenyiGenerator(size_t(1) << scale, 8 << scale);
+}
+
+BarabasiAlbertGenerator barabasiAlbert(unsigned scale) {
+  return BarabasiAlbertGenerator(size_t(1) << scale, 8);
+}
+
+WattsStrogatzGenerator wattsStrogatz(unsigned scale) {
+  return WattsStrogatzGenerator(size_t(1) << scale, 16, 0.1);
+}
+
+RandomGeometricGenerator randomGeometric(unsigned scale, uint64_t seed) {
+  size_t vertices = size_t(1) << scale;
+  return RandomGeometricGenerator(vertices, sqrt(16 / (3.14159265358979 * double(vertices))),
+                                  seed);
+}
+
+// Road like: a grid of 2^(scale / 2) columns with random lengths
+GridGenerator grid(unsigned scale) {
+  size_t columns = size_t(1) << (scale / 2);
+  return GridGenerator((size_t(1) << scale) / columns, columns);
+}
+
+// The edges of a generator, in the order of its units
+template <typename Generator>
+EdgeList edgeList(const string& name, unsigned scale, const Generator& generator) {
+  EdgeList list{name, scale, generator.vertexCount(), {}};
+  auto emit = [&](uint32_t source, uint32_t target, int weight) {
+    list.edges.emplace_back(int(source), int(target), weight);
+  };
+  for (uint64_t unit = 0; unit < generator.units(); unit++) {
+    generator.generate(unit, emit);
+  }
+  return list;
+}
+
+// ------------------------- measurements -------------------------
+
+class Runner {
+ public:
+  explicit Runner(const Options& options) : options(options) {}
+
+  bool wanted(const string& benchmark) const {
+    return options.filter.empty() or benchmark.find(options.filter) != string::npos;
+  }
+
+  // Times fn, which processes items units, and keeps the median
+  template <typename Function>
+  void run(const string& benchmark, const string& graph, unsigned scale, size_t vertices,
+           size_t edges, double items, const string& unit, Function fn) {
+    if (not wanted(benchmark)) return;
+    vector<double> times;
+    for (unsigned r = 0; r < options.repetitions; r++) {
+      auto start = chrono::steady_clock::now();
+      fn();
+      times.push_back(chrono::duration<double>(chrono::steady_clock::now() - start).count());
+    }
+    sort(times.begin(), times.end());
+    Result result{benchmark, graph, scale, vertices, edges, times[times.size() / 2], items, unit};
+    results.push_back(result);
+    printf("%-26s %-12s %5u %9zu %10zu %12.6f s %14.0f %s/s\n", benchmark.c_str(),
+           graph.c_str(), scale, vertices, edges, result.seconds,
+           result.seconds > 0 ? items / result.seconds : 0.0, unit.c_str());
+    fflush(stdout);
+  }
+
+  void writeJson(ostream& out) const {
+    out << "{\n  \"suite\": \"graph_bench\",\n  \"seed\": " << options.seed
+        << ",\n  \"repetitions\": " << options.repetitions << ",\n  \"results\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+      const Result& r = results[i];
+      char rate[64];
+      snprintf(rate, sizeof(rate), "%.3f", r.seconds > 0 ? r.items / r.seconds : 0.0);
+      char seconds[64];
+      snprintf(seconds, sizeof(seconds), "%.9f", r.seconds);
+      out << (i == 0 ? "\n" : ",\n") << "    {\"benchmark\": \"" << r.benchmark
+          << "\", \"graph\": \"" << r.graph << "\", \"scale\": " << r.scale
+          << ", \"vertices\": " << r.vertices << ", \"edges\": " << r.edges
+          << ", \"seconds\": " << seconds << ", \"items\": " << size_t(r.items)
+          << ", \"unit\": \"" << r.unit << "\", \"per_second\": " << rate << "}";
+    }
+    out << "\n  ]\n}\n";
+  }
+
+ private:
+  const Options& options;
+  vector<Result> results;
+};
+
+// Benchmarks of the queries, on any kind of ids
+template <typename T>
+void queries(Runner& runner, const string& name, unsigned scale, Graph<T>& graph,
+             uint64_t seed) {
+  AdjacencySnapshot<T> snapshot(graph);
+  const vector<T>& ids = snapshot.getIds();
+  size_t vertices = snapshot.size();
+  size_t edges = snapshot.edgeCount() / 2; // undirected, every edge is in two rows
+  const T& root = ids[0];
+  auto run = [&](const string& benchmark, double items, const string& unit,
+                 const function<void()>& fn) {
+    runner.run(benchmark, name, scale, vertices, edges, items, unit, fn);
+  };
+
+  run("bfs", double(edges), "edges", [&]() { checksum += graph.bfs(root).getDegree(); });
+  run("dfs", double(edges), "edges", [&]() { checksum += graph.dfs(root).getDegree(); });
+  run("prim", double(edges), "edges", [&]() { checksum += graph.prim(root).getDegree(); });
+  run("dijkstra_sssp", double(edges), "edges", [&]() { graph.dijkstra(root); });
+
+  mt19937_64 random(seed);
+  uniform_int_distribution<size_t> vertex(0, vertices - 1);
+  vector<pair<T, T>> pairs;
+  for (size_t q = 0; q < POINT_TO_POINT_QUERIES; q++) {
+    pairs.emplace_back(ids[vertex(random)], ids[vertex(random)]);
+  }
+  run("dijkstra_point_to_point", double(pairs.size()), "queries", [&]() {
+    for (const pair<T, T>& query : pairs) {
+      int distance;
+      checksum += graph.dijkstra(query.first, query.second, distance).getLength();
+    }
+  });
+
+  run("dotRepr", double(edges), "edges", [&]() { checksum += graph.dotRepr().size(); });
+
+  size_t frames = graph.bfs_frames(root).size();
+  run("bfs_frames_deltas", double(frames), "frames", [&]() {
+    AnimationFrames<T> animation = graph.bfs_frames(root);
+    ostringstream out;
+    for (size_t k = 0; k < animation.size(); k++) {
+      animation.writeDelta(out, k);
+    }
+    checksum += out.str().size();
+  });
+  run("dijkstra_trace", double(edges), "edges", [&]() {
+    checksum += graph.dijkstra_trace(root).size();
+  });
+  if (vertices <= MAX_ANIMATION_VERTICES) {
+    run("bfs_animation", double(frames), "frames", [&]() {
+      checksum += size_t(graph.bfs_animation(root).getLength());
+    });
+    run("dfs_animation", double(frames), "frames", [&]() {
+      checksum += size_t(graph.dfs_animation(root).getLength());
+    });
+    size_t dijkstra_frames = graph.dijkstra_trace(root).size();
+    run("dijkstra_animation", double(dijkstra_frames), "frames", [&]() {
+      checksum += size_t(graph.dijkstra_animation(root).getLength());
+    });
+  }
+}
+
+template <typename Generator>
+void generated(Runner& runner, const string& name, unsigned scale, Generator generator,
+               uint64_t seed) {
+  generator.setSeed(seed + scale);
+  generator.setWeights(1, MAX_WEIGHT);
+  EdgeList list = edgeList(name, scale, generator);
+  size_t vertices = list.vertices;
+  size_t edges = list.edges.size();
+  runner.run("generate_snapshot", name, scale, vertices, edges, double(edges), "edges",
+             [&]() { checksum += generateSnapshot(generator).edgeCount(); });
+  if (vertices <= MAX_INGEST_VERTICES) {
+    runner.run("ingest_newVertex_newEdge", list.name, list.scale, vertices, edges,
+               double(vertices + edges), "calls", [&]() {
+      Graph<int> graph(true, false);
+      for (size_t v = 0; v < vertices; v++) {
+        graph.newVertex(int(v));
+      }
+      for (const tuple<int, int, int>& edge : list.edges) {
+        graph.newEdge(get<0>(edge), get<1>(edge), get<2>(edge));
+      }
+      checksum += graph.getDegree();
+    });
+  }
+  GraphBuilder<int> builder(true, false);
+  auto fill = [&]() {
+    builder.clear();
+    builder.reserve(vertices, edges);
+    for (size_t v = 0; v < vertices; v++) {
+      builder.addVertex(int(v));
+    }
+    for (const tuple<int, int, int>& edge : list.edges) {
+      builder.addEdgeByIndex(uint32_t(get<0>(edge)), uint32_t(get<1>(edge)), get<2>(edge));
+    }
+  };
+  runner.run("ingest_builder", list.name, list.scale, vertices, edges, double(edges), "edges",
+             [&]() {
+    fill();
+    checksum += builder.build().getDegree();
+  });
+  fill();
+  Graph<int> graph = builder.build();
+  queries(runner, list.name, list.scale, graph, seed);
+}
+
+bool parse(int argc, char** argv, Options& options) {
+  for (int i = 1; i < argc; i++) {
+    string argument = argv[i];
+    if (i + 1 >= argc) return false;
+    string value = argv[++i];
+    if (argument == "--scale") {
+      int scale = atoi(value.c_str());
+      if (scale < 2 or scale > 30) return false;
+      options.scales.push_back(unsigned(scale));
+    } else if (argument == "--repetitions") {
+      int repetitions = atoi(value.c_str());
+      if (repetitions < 1) return false;
+      options.repetitions = unsigned(repetitions);
+    } else if (argument == "--filter") {
+      options.filter = value;
+    } else if (argument == "--seed") {
+      options.seed = strtoull(value.c_str(), nullptr, 10);
+    } else if (argument == "--json") {
+      options.json = value;
+    } else {
+      return false;
+    }
+  }
+  if (options.scales.empty()) {
+    options.scales = {8, 10, 12};
+  }
+  return true;
+}
+
+} // anonymous namespace end
+
+int main(int argc, char** argv) {
+  Options options;
+  if (not parse(argc, argv, options)) {
+    cerr << "usage: " << argv[0] << " [--scale N]... [--repetitions R] [--filter TEXT]"
+         << " [--seed S] [--json FILE]" << endl;
+    return 2;
+  }
+  Runner runner(options);
+  printf("%-26s %-12s %5s %9s %10s %14s %14s\n", "benchmark", "graph", "scale", "vertices",
+         "edges", "median", "throughput");
+
+  unsigned metro_scale = 0;
+  size_t metro_vertices = create_net().getDegree();
+  while ((size_t(1) << (metro_scale + 1)) <= metro_vertices) metro_scale++;
+  size_t metro_edges = AdjacencySnapshot<string>(create_net()).edgeCount() / 2;
+  runner.run("ingest_newVertex_newEdge", "metro", metro_scale, metro_vertices, metro_edges,
+             double(metro_vertices + metro_edges), "calls",
+             []() { checksum += create_net().getDegree(); });
+  Graph<string> metro = create_net();
+  queries(runner, "metro", metro_scale, metro, options.seed);
+
+  for (unsigned scale : options.scales) {
+    generated(runner, "rmat", scale, rmat(scale), options.seed);
+    generated(runner, "erdos_renyi", scale, erdosRenyi(scale), options.seed);
+    generated(runner, "barabasi", scale, barabasiAlbert(scale), options.seed);
+    generated(runner, "watts", scale, wattsStrogatz(scale), options.seed);
+    generated(runner, "geometric", scale, randomGeometric(scale, options.seed + scale), options.seed);
+    generated(runner, "grid", scale, grid(scale), options.seed);
+  }
+
+  if (not options.json.empty()) {
+    ofstream out(options.json);
+    runner.writeJson(out);
+    if (not out) {
+      cerr << "could not write " << options.json << endl;
+      return 1;
+    }
+  }
+  printf("checksum %zu\n", checksum);
+  return 0;
+}
@@ -0,0 +1,192 @@
+#ifndef ADJACENCY_SNAPSHOT_H
+#define ADJACENCY_SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "graph.h"
+
+namespace easy_graphs {
+
+/*
+  Read-only copy of the adjacency list of a Graph in compressed sparse rows.
+  Vertices are numbered 0 .. size() - 1 by their insertion order in the
+  graph and the neighbours of each vertex are contiguous in memory, which
+  is what the whole-graph analytics need to run fast and in parallel.
+  The snapshot does not follow later changes of the graph.
+ */
+template<class T>
+class AdjacencySnapshot {
+ public:
+  // An empty snapshot
+  AdjacencySnapshot() {}
+
+  /*
+    Takes the snapshot of a graph. With transposed every row holds the
+    in-neighbours of the vertex instead of its out-neighbours.
+    Complexity: O(V + E)
+   */
+  explicit AdjacencySnapshot(const Graph<T>& graph, bool transposed = false)
+      : weighted(graph.weighted), directed(graph.directed),
+        transposed(transposed) {
+    EASY_GRAPHS_TRACE("AdjacencySnapshot::AdjacencySnapshot");
+    for (const Vertex<T>* vertex : graph.vertexTable()) {
+      ids.push_back(vertex->getId());
+    }
+    graph.compressedRows(offsets, targets, weights, transposed);
+  }
+
+  /*
+    Snapshot from already built arrays, offsets must have ids.size() + 1
+    entries and weights must be empty for unweighted graphs.
+   */
+  AdjacencySnapshot(bool weighted, bool directed, std::vector<T> ids,
+                    std::vector<size_t> offsets, std::vector<uint32_t> targets,
+                    std::vector<int> weights = {}, bool transposed = false)
+      : weighted(weighted), directed(directed), transposed(transposed),
+        ids(std::move(ids)), offsets(std::move(offsets)),
+        targets(std::move(targets)), weights(std::move(weights)) {
+    if (this->offsets.empty()) this->offsets.push_back(0);
+  }
+
+  size_t size() const { return ids.size(); }
+
+  size_t edgeCount() const { return targets.size(); }
+
+  bool isWeighted() const { return weighted; }
+
+  bool isDirected() const { return directed; }
+
+  // If true the rows hold in-neighbours
+  bool isTransposed() const { return transposed; }
+
+  const T& getId(size_t vertex) const { return ids[vertex]; }
+
+  size_t degree(size_t vertex) const {
+    return offsets[vertex + 1] - offsets[vertex];
+  }
+
+  // First and one past the last position of the row of a vertex
+  size_t rowBegin(size_t vertex) const { return offsets[vertex]; }
+  size_t rowEnd(size_t vertex) const { return offsets[vertex + 1]; }
+
+  uint32_t target(size_t edge) const { return targets[edge]; }
+
+  int weight(size_t edge) const { return weights.empty() ? 1 : weights[edge]; }
+
+  const std::vector<T>& getIds() const { return ids; }
+  const std::vector<size_t>& getOffsets() const { return offsets; }
+  const std::vector<uint32_t>& getTargets() const { return targets; }
+  // Empty for unweighted graphs
+  const std::vector<int>& getWeights() const { return weights; }
+
+  /*
+    The same snapshot with the direction of the rows swapped.
+    Complexity: O(V + E)
+   */
+  AdjacencySnapshot transpose() const;
+
+  /*
+    The simple undirected graph underlying the snapshot: unweighted, with
+    sorted rows and without self loops nor parallel edges.
+    Complexity: O(V + E)
+   */
+  AdjacencySnapshot simplified() const;
+
+ private:
+  bool weighted = false;
+  bool directed = false;
+  bool transposed = false;
+  std::vector<T> ids;
+  std::vector<size_t> offsets = {0};
+  std::vector<uint32_t> targets;
+  std::vector<int> weights;
+};
+
+// ----------------- IMPLEMENTATION --------------------
+
+template <typename T>
+AdjacencySnapshot<T> AdjacencySnapshot<T>::transpose() const {
+    size_t size = ids.size();
+    std::vector<size_t> new_offsets(size + 1, 0);
+    for (uint32_t column : targets) {
+        new_offsets[column + 1]++;
+    }
+    for (size_t i = 0; i < size; i++) {
+        new_offsets[i + 1] += new_offsets[i];
+    }
+    std::vector<uint32_t> new_targets(targets.size());
+    std::vector<int> new_weights(weights.size());
+    std::vector<size_t> next(new_offsets.begin(), new_offsets.end() - 1);
+    for (size_t row = 0; row < size; row++) {
+        for (size_t e = offsets[row]; e < offsets[row + 1]; e++) {
+            size_t position = next[targets[e]]++;
+            new_targets[position] = uint32_t(row);
+            if (not weights.empty()) {
+                new_weights[position] = weights[e];
+            }
+        }
+    }
+    return AdjacencySnapshot(weighted, directed, ids, std::move(new_offsets),
+                             std::move(new_targets), std::move(new_weights),
+                             not transposed);
+}
+
+template <typename T>
+AdjacencySnapshot<T> AdjacencySnapshot<T>::simplified() const {
+    size_t size = ids.size();
+    AdjacencySnapshot reverse;
+    if (directed) {
+        reverse = transpose();
+    }
+    // Appending each vertex, by increasing index, to the rows of its
+    // neighbours leaves every row sorted, with duplicates adjacent
+    std::vector<size_t> starts(size + 1, 0);
+    for (size_t row = 0; row < size; row++) {
+        for (size_t e = offsets[row]; e < offsets[row + 1]; e++) {
+            starts[targets[e] + 1]++;
+        }
+        if (directed) {
+            for (size_t e = reverse.offsets[row]; e < reverse.offsets[row + 1]; e++) {
+                starts[reverse.targets[e] + 1]++;
+            }
+        }
+    }
+    for (size_t i = 0; i < size; i++) {
+        starts[i + 1] += starts[i];
+    }
+    std::vector<uint32_t> new_targets(starts[size]);
+    std::vector<size_t> next(starts.begin(), starts.end() - 1);
+    for (size_t row = 0; row < size; row++) {
+        for (size_t e = offsets[row]; e < offsets[row + 1]; e++) {
+            new_targets[next[targets[e]]++] = uint32_t(row);
+        }
+        if (directed) {
+            for (size_t e = reverse.offsets[row]; e < reverse.offsets[row + 1]; e++) {
+                new_targets[next[reverse.targets[e]]++] = uint32_t(row);
+            }
+        }
+    }
+    std::vector<size_t> new_offsets(size + 1, 0);
+    size_t write = 0;
+    for (size_t row = 0; row < size; row++) {
+        new_offsets[row] = write;
+        for (size_t e = starts[row]; e < starts[row + 1]; e++) {
+            uint32_t column = new_targets[e];
+            if (column != row and
+                (write == new_offsets[row] or new_targets[write - 1] != column)) {
+                new_targets[write++] = column;
+            }
+        }
+    }
+    new_offsets[size] = write;
+    new_targets.resize(write);
+    return AdjacencySnapshot(false, false, ids, std::move(new_offsets),
+                             std::move(new_targets));
+}
+
+} // easy_graphs namespace end
+
+#endif // ADJACENCY_SNAPSHOT_H
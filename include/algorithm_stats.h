@@ -0,0 +1,121 @@
+/*
+  Counters of the work done by the traversals and shortest path algorithms
+  of Graph, to find out why a query was slow. They are opt-in: the
+  algorithms take an AlgorithmStats* which is nullptr by default, and
+  defining EASY_GRAPHS_DISABLE_STATS before including the library compiles
+  the counting out (the parameters stay, the stats are left at zero).
+ */
+
+#ifndef ALGORITHM_STATS_H
+#define ALGORITHM_STATS_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace easy_graphs {
+
+  /*
+    Every call adds its counts to the ones already there, so the same object
+    can sum several calls; reset() starts again. The peak frontier is the
+    biggest of the calls.
+   */
+  struct AlgorithmStats {
+#ifdef EASY_GRAPHS_DISABLE_STATS
+    static constexpr bool ENABLED = false;
+#else
+    static constexpr bool ENABLED = true;
+#endif
+
+    uint64_t vertices_visited = 0; // dequeued by bfs / dfs, settled by dijkstra / prim
+    uint64_t edges_scanned = 0;
+    uint64_t relaxations = 0;      // distances (or prim keys) improved
+    uint64_t heap_pushes = 0;
+    uint64_t heap_pops = 0;
+    uint64_t stale_pops = 0;       // popped entries of vertices already settled
+    uint64_t peak_frontier = 0;    // biggest queue, stack or heap
+    double seconds = 0;            // wall time
+
+    void reset() { *this = AlgorithmStats(); }
+
+    // One line of key=value pairs, e.g. for logs or benchmark output
+    template <typename Sink>
+    void write(Sink& out) const {
+      out << "visited=" << vertices_visited << " edges_scanned=" << edges_scanned
+          << " relaxations=" << relaxations << " heap_pushes=" << heap_pushes
+          << " heap_pops=" << heap_pops << " stale_pops=" << stale_pops
+          << " peak_frontier=" << peak_frontier << " seconds=" << seconds;
+    }
+  };
+
+#ifndef EASY_GRAPHS_DISABLE_STATS
+
+  /*
+    Used inside the algorithms: counts in its own fields and adds them to
+    the AlgorithmStats, if there is one, when it is destroyed at the end of
+    the algorithm. The clock is only read when there is somewhere to put
+    the time.
+   */
+  class StatsRecorder {
+  public:
+    explicit StatsRecorder(AlgorithmStats* stats) : stats(stats) {
+      if (stats != nullptr) start = std::chrono::steady_clock::now();
+    }
+
+    StatsRecorder(const StatsRecorder&) = delete;
+    StatsRecorder& operator=(const StatsRecorder&) = delete;
+
+    ~StatsRecorder() {
+      if (stats == nullptr) return;
+      counts.seconds = std::chrono::duration<double>(
+          std::chrono::steady_clock::now() - start).count();
+      stats->vertices_visited += counts.vertices_visited;
+      stats->edges_scanned += counts.edges_scanned;
+      stats->relaxations += counts.relaxations;
+      stats->heap_pushes += counts.heap_pushes;
+      stats->heap_pops += counts.heap_pops;
+      stats->stale_pops += counts.stale_pops;
+      if (counts.peak_frontier > stats->peak_frontier) {
+        stats->peak_frontier = counts.peak_frontier;
+      }
+      stats->seconds += counts.seconds;
+    }
+
+    void visit() { counts.vertices_visited++; }
+    void scan() { counts.edges_scanned++; }
+    void relax() { counts.relaxations++; }
+    void push() { counts.heap_pushes++; }
+    void pop() { counts.heap_pops++; }
+    void stale() { counts.stale_pops++; }
+    void frontier(size_t size) {
+      if (size > counts.peak_frontier) counts.peak_frontier = size;
+    }
+
+  private:
+    AlgorithmStats* stats;
+    AlgorithmStats counts;
+    std::chrono::steady_clock::time_point start;
+  };
+
+#else
+
+  // Compiled out: every call is empty
+  class StatsRecorder {
+  public:
+    explicit StatsRecorder(AlgorithmStats*) {}
+
+    void visit() {}
+    void scan() {}
+    void relax() {}
+    void push() {}
+    void pop() {}
+    void stale() {}
+    void frontier(size_t) {}
+  };
+
+#endif // EASY_GRAPHS_DISABLE_STATS
+
+  // easy_graphs namespace end
+}
+
+#endif // ALGORITHM_STATS_H
@@ -0,0 +1,507 @@
+#ifndef ANIMATION_H
+#define ANIMATION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "layout.h"
+#include "list.h"
+
+namespace easy_graphs {
+
+// Pair of iterators usable in range based for loops and dot_extension::renderFrames
+template <class Iterator>
+class FrameRange {
+ public:
+  FrameRange(Iterator first, Iterator last) : first(first), last(last) {}
+
+  Iterator begin() const { return first; }
+  Iterator end() const { return last; }
+
+ private:
+  Iterator first;
+  Iterator last;
+};
+
+/*
+  Frames of the animation of a traversal (Graph::bfs_frames and
+  Graph::dfs_frames), kept as the discovered vertices and the parent of
+  each one instead of as strings: O(V) memory for any number of frames.
+  Frame 0 is the root alone and frame k adds the k-th tree edge, the same
+  DOT texts Graph::bfs_animation returns.
+
+  The delta format: delta(0) is the header and the root, delta(k) the line
+  of the k-th edge, so frame(k) = delta(0) + ... + delta(k) + "}". A
+  consumer can keep appending deltas and only close a copy of the text
+  when it needs a full frame, which is what the iterator of the frames
+  does: going through all of them costs O(1) work per step on top of the
+  copies the consumer makes.
+ */
+template <class T>
+class AnimationFrames {
+ public:
+  // Walks the frames building every one from the previous one
+  class Iterator {
+   public:
+    typedef std::input_iterator_tag iterator_category;
+    typedef std::string value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const std::string* pointer;
+    typedef const std::string& reference;
+
+    // With a layout the frames are the pinned ones
+    Iterator(const AnimationFrames* frames, size_t position,
+             const FixedLayout* layout = nullptr)
+        : frames(frames), position(position), layout(layout) {
+      if (position < frames->size()) {
+        text = layout ? frames->pinnedFrame(position, *layout) : frames->frame(position);
+      }
+    }
+
+    const std::string& operator*() const { return text; }
+    const std::string* operator->() const { return &text; }
+
+    Iterator& operator++() {
+      if (++position >= frames->size()) {
+        text.clear();
+      } else if (layout) {
+        text = frames->pinnedFrame(position, *layout);
+      } else {
+        text.pop_back(); // the closing brace
+        text += frames->delta(position);
+        text += '}';
+      }
+      return *this;
+    }
+
+    bool operator==(const Iterator& other) const { return position == other.position; }
+    bool operator!=(const Iterator& other) const { return position != other.position; }
+
+   private:
+    const AnimationFrames* frames;
+    size_t position;
+    const FixedLayout* layout;
+    std::string text;
+  };
+
+  // No frames, for a root which does not exist
+  AnimationFrames() {}
+
+  explicit AnimationFrames(const T& root) : vertices{root}, parents{0} {}
+
+  // Next tree edge: parent is the position of the parent in discovery order
+  void addEdge(size_t parent, const T& child) {
+    vertices.push_back(child);
+    parents.push_back(uint32_t(parent));
+  }
+
+  // Number of frames, one more than the number of tree edges
+  size_t size() const { return vertices.size(); }
+
+  bool empty() const { return vertices.empty(); }
+
+  // Vertex discovered in frame k and the position of its parent
+  const T& vertex(size_t k) const { return vertices[k]; }
+  size_t parent(size_t k) const { return parents[k]; }
+
+  // Complexity: O(k)
+  template <typename Sink>
+  void writeFrame(Sink& out, size_t k) const {
+    for (size_t i = 0; i <= k; i++) {
+      writeDelta(out, i);
+    }
+    out << '}';
+  }
+
+  std::string frame(size_t k) const {
+    std::ostringstream ss;
+    writeFrame(ss, k);
+    return ss.str();
+  }
+
+  // Complexity: O(1)
+  template <typename Sink>
+  void writeDelta(Sink& out, size_t k) const {
+    if (k == 0) {
+      out << "digraph {\n\t\"" << vertices[0] << "\"\n";
+    } else {
+      out << "\t\"" << vertices[parents[k]] << "\" -> \"" << vertices[k] << "\"\n";
+    }
+  }
+
+  std::string delta(size_t k) const {
+    std::ostringstream ss;
+    writeDelta(ss, k);
+    return ss.str();
+  }
+
+  /*
+    Frame k for neato -n: every node of the layout is declared with its
+    position, those not discovered yet invisible, so the nodes do not move
+    and the drawing keeps its size along the animation. Vertices missing
+    in the layout are left for neato to place.
+    Complexity: O(k + nodes of the layout)
+   */
+  template <typename Sink>
+  void writePinnedFrame(Sink& out, size_t k, const FixedLayout& layout) const;
+
+  std::string pinnedFrame(size_t k, const FixedLayout& layout) const {
+    std::ostringstream ss;
+    writePinnedFrame(ss, k, layout);
+    return ss.str();
+  }
+
+  Iterator begin() const { return Iterator(this, 0); }
+  Iterator end() const { return Iterator(this, size()); }
+
+  // All the frames pinned to a layout, which must outlive the range
+  FrameRange<Iterator> pinned(const FixedLayout& layout) const {
+    return FrameRange<Iterator>(Iterator(this, 0, &layout), Iterator(this, size()));
+  }
+
+  // Every frame as a string, the old format of the animations. Complexity: O(V^2)
+  List<std::string> toList() const {
+    List<std::string> animation;
+    for (const std::string& frame : *this) {
+      animation.append(frame);
+    }
+    return animation;
+  }
+
+ private:
+  std::vector<T> vertices; // in discovery order
+  std::vector<uint32_t> parents;
+};
+
+// One step of Dijkstra, see DijkstraTrace
+struct DijkstraEvent {
+  enum Kind : uint8_t {
+    RELAXED, // vertex got the shorter distance through parent
+    SETTLED  // vertex left the heap, distance is final
+  };
+
+  DijkstraEvent(Kind kind, uint32_t vertex, int distance, uint32_t parent)
+      : kind(kind), vertex(vertex), distance(distance), parent(parent) {}
+
+  Kind kind;
+  uint32_t vertex;
+  int distance;
+  uint32_t parent; // the vertex itself for the source
+};
+
+/*
+  Record of a run of Dijkstra (Graph::dijkstra_trace): the events, 16
+  bytes each, plus a copy of the edges to draw them. Frame 0 shows the
+  initial distances and frame k the distances after the k-th relaxation,
+  the same DOT texts Graph::dijkstra_animation returns. The iterator keeps
+  the "id | distance" label of every vertex and only rewrites the labels
+  the events change, so a step replays one event instead of the whole run,
+  but every frame still holds all the edges: O(V + E) text per frame.
+
+  The delta format, for consumers which only need what changed: delta(0)
+  declares every vertex with its initial label and the edges between the
+  ids, delta(i) is the event i - 1, a line redeclaring the label of the
+  relaxed vertex or a "// settled" comment line. DOT keeps the last label
+  given to a node, so delta(0) + ... + delta(i) + "}" draws the distances
+  after that event, and streaming the whole run costs O(V + E + number of
+  events) instead of O(V + E) per frame.
+ */
+template <class T>
+class DijkstraTrace {
+ public:
+  // Walks the frames applying the events to a table of labels
+  class Iterator {
+   public:
+    typedef std::input_iterator_tag iterator_category;
+    typedef std::string value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const std::string* pointer;
+    typedef const std::string& reference;
+
+    // With a layout the frames are the pinned ones
+    Iterator(const DijkstraTrace* trace, bool at_end,
+             const FixedLayout* layout = nullptr)
+        : trace(trace), position(at_end ? trace->size() : 0), layout(layout) {
+      if (position < trace->size()) {
+        trace->initialLabels(labels);
+        render();
+      }
+    }
+
+    const std::string& operator*() const { return text; }
+    const std::string* operator->() const { return &text; }
+
+    Iterator& operator++() {
+      if (++position < trace->size()) {
+        event = trace->applyUntilRelaxation(labels, event);
+        render();
+      } else {
+        text.clear();
+      }
+      return *this;
+    }
+
+    bool operator==(const Iterator& other) const { return position == other.position; }
+    bool operator!=(const Iterator& other) const { return position != other.position; }
+
+   private:
+    void render() {
+      std::ostringstream ss;
+      if (layout) {
+        trace->writePinnedLabels(ss, labels, *layout);
+      } else {
+        trace->writeLabels(ss, labels);
+      }
+      text = ss.str();
+    }
+
+    const DijkstraTrace* trace;
+    size_t position;
+    const FixedLayout* layout;
+    size_t event = 0; // next event to apply
+    std::vector<std::string> labels;
+    std::string text;
+  };
+
+  DijkstraTrace() {}
+
+  /*
+    Trace of a graph given in compressed sparse rows (see
+    AdjacencySnapshot), events are added with record
+   */
+  DijkstraTrace(bool weighted, bool directed, const std::vector<T>& ids,
+                std::vector<size_t> offsets, std::vector<uint32_t> targets,
+                std::vector<int> weights, uint32_t source)
+      : weighted(weighted), directed(directed), offsets(std::move(offsets)),
+        targets(std::move(targets)), weights(std::move(weights)), source(source) {
+    for (const T& id : ids) {
+      std::ostringstream ss;
+      ss << id;
+      names.push_back(ss.str());
+    }
+  }
+
+  void record(const DijkstraEvent& event) {
+    events.push_back(event);
+    if (event.kind == DijkstraEvent::RELAXED) relaxations++;
+  }
+
+  const std::vector<DijkstraEvent>& getEvents() const { return events; }
+
+  // Number of frames, one more than the number of relaxations
+  size_t size() const { return names.empty() ? 0 : relaxations + 1; }
+
+  bool empty() const { return names.empty(); }
+
+  // Complexity: O(V + E + number of events)
+  template <typename Sink>
+  void writeFrame(Sink& out, size_t k) const {
+    std::vector<std::string> labels;
+    initialLabels(labels);
+    size_t event = 0;
+    for (size_t i = 0; i < k; i++) {
+      event = applyUntilRelaxation(labels, event);
+    }
+    writeLabels(out, labels);
+  }
+
+  std::string frame(size_t k) const {
+    std::ostringstream ss;
+    writeFrame(ss, k);
+    return ss.str();
+  }
+
+  /*
+    Frame k for neato -n: the nodes keep their names and positions and
+    the distances go to their labels. Vertices missing in the layout are
+    left for neato to place.
+    Complexity: O(V + E + number of events)
+   */
+  template <typename Sink>
+  void writePinnedFrame(Sink& out, size_t k, const FixedLayout& layout) const {
+    std::vector<std::string> labels;
+    initialLabels(labels);
+    size_t event = 0;
+    for (size_t i = 0; i < k; i++) {
+      event = applyUntilRelaxation(labels, event);
+    }
+    writePinnedLabels(out, labels, layout);
+  }
+
+  // Number of deltas, one more than the number of events
+  size_t deltaCount() const { return names.empty() ? 0 : events.size() + 1; }
+
+  // Complexity: O(V + E) for delta 0, O(1) for the others
+  template <typename Sink>
+  void writeDelta(Sink& out, size_t i) const {
+    if (i == 0) {
+      out << (directed ? "digraph " : "strict graph ") << " {\n";
+      for (size_t v = 0; v < names.size(); v++) {
+        out << "\t\"" << names[v] << "\" [label=\""
+            << label(v, v == source ? 0 : INT32_MAX) << "\"]\n";
+      }
+      writeNamedEdges(out);
+    } else if (events[i - 1].kind == DijkstraEvent::RELAXED) {
+      const DijkstraEvent& event = events[i - 1];
+      out << "\t\"" << names[event.vertex] << "\" [label=\""
+          << label(event.vertex, event.distance) << "\"]\n";
+    } else {
+      out << "\t// settled \"" << names[events[i - 1].vertex] << "\"\n";
+    }
+  }
+
+  std::string delta(size_t i) const {
+    std::ostringstream ss;
+    writeDelta(ss, i);
+    return ss.str();
+  }
+
+  // Every delta followed by the closing brace. Complexity: O(V + E + number of events)
+  template <typename Sink>
+  void writeDeltas(Sink& out) const {
+    for (size_t i = 0; i < deltaCount(); i++) {
+      writeDelta(out, i);
+    }
+    if (not empty()) out << '}';
+  }
+
+  Iterator begin() const { return Iterator(this, false); }
+  Iterator end() const { return Iterator(this, true); }
+
+  // All the frames pinned to a layout, which must outlive the range
+  FrameRange<Iterator> pinned(const FixedLayout& layout) const {
+    return FrameRange<Iterator>(Iterator(this, false, &layout), Iterator(this, true));
+  }
+
+ private:
+  std::string label(size_t vertex, int distance) const {
+    return names[vertex] + " | " +
+           (distance == INT32_MAX ? std::string("inf") : std::to_string(distance));
+  }
+
+  void initialLabels(std::vector<std::string>& labels) const {
+    labels.clear();
+    for (size_t v = 0; v < names.size(); v++) {
+      labels.push_back(label(v, v == source ? 0 : INT32_MAX));
+    }
+  }
+
+  // Applies the events from the given one to the next relaxation included,
+  // returns the position after it
+  size_t applyUntilRelaxation(std::vector<std::string>& labels, size_t event) const {
+    for (; event < events.size(); event++) {
+      if (events[event].kind == DijkstraEvent::RELAXED) {
+        labels[events[event].vertex] = label(events[event].vertex, events[event].distance);
+        return event + 1;
+      }
+    }
+    return event;
+  }
+
+  // Same text as Graph::dotRepr(GraphDrawingMode::SHOW_DISTANCES)
+  template <typename Sink>
+  void writeLabels(Sink& out, const std::vector<std::string>& labels) const {
+    out << (directed ? "digraph " : "strict graph ") << " {\n";
+    const char* edge_op = directed ? "\" -> \"" : "\" -- \"";
+    for (size_t v = 0; v < names.size(); v++) {
+      if (offsets[v] == offsets[v + 1]) {
+        out << "\t\"" << names[v] << "\"\n";
+        continue;
+      }
+      for (size_t e = offsets[v]; e < offsets[v + 1]; e++) {
+        out << "\t\"" << labels[v] << edge_op << labels[targets[e]] << "\" [";
+        if (weighted) {
+          out << "taillabel = \"" << weights[e] << "\", ";
+        }
+        out << "labeldistance = 1.5]\n";
+      }
+    }
+    out << "}";
+  }
+
+  template <typename Sink>
+  void writePinnedLabels(Sink& out, const std::vector<std::string>& labels,
+                         const FixedLayout& layout) const {
+    out << (directed ? "digraph " : "strict graph ") << " {\n\tnode [pin=true]\n";
+    for (size_t v = 0; v < names.size(); v++) {
+      out << "\t\"" << names[v] << "\" [label=\"" << labels[v] << '"';
+      long node = layout.indexOf(names[v]);
+      if (node >= 0) {
+        out << ", ";
+        layout.writePosition(out, node);
+      }
+      out << "]\n";
+    }
+    writeNamedEdges(out);
+    out << "}";
+  }
+
+  // The edges between the ids, the labels go to the nodes
+  template <typename Sink>
+  void writeNamedEdges(Sink& out) const {
+    const char* edge_op = directed ? "\" -> \"" : "\" -- \"";
+    for (size_t v = 0; v < names.size(); v++) {
+      for (size_t e = offsets[v]; e < offsets[v + 1]; e++) {
+        out << "\t\"" << names[v] << edge_op << names[targets[e]] << "\" [";
+        if (weighted) {
+          out << "taillabel = \"" << weights[e] << "\", ";
+        }
+        out << "labeldistance = 1.5]\n";
+      }
+    }
+  }
+
+  bool weighted = false;
+  bool directed = false;
+  std::vector<std::string> names; // ids as text
+  std::vector<size_t> offsets = {0};
+  std::vector<uint32_t> targets;
+  std::vector<int> weights;
+  uint32_t source = 0;
+  std::vector<DijkstraEvent> events;
+  size_t relaxations = 0;
+};
+
+// ----------------- IMPLEMENTATION --------------------
+
+template <typename T>
+template <typename Sink>
+void AnimationFrames<T>::writePinnedFrame(Sink& out, size_t k,
+                                          const FixedLayout& layout) const {
+    out << "digraph {\n\tnode [pin=true]\n";
+    std::vector<bool> shown(layout.size(), false);
+    std::vector<std::string> names;
+    for (size_t i = 0; i <= k; i++) {
+        std::ostringstream name;
+        name << vertices[i];
+        names.push_back(name.str());
+        out << "\t\"" << names[i] << '"';
+        long node = layout.indexOf(names[i]);
+        if (node >= 0) {
+            out << " [";
+            layout.writePosition(out, node);
+            out << ']';
+            shown[node] = true;
+        }
+        out << '\n';
+    }
+    for (size_t node = 0; node < layout.size(); node++) {
+        if (not shown[node]) {
+            out << "\t\"" << layout.getName(node) << "\" [";
+            layout.writePosition(out, node);
+            out << ", style=invis]\n";
+        }
+    }
+    for (size_t i = 1; i <= k; i++) {
+        out << "\t\"" << names[parents[i]] << "\" -> \"" << names[i] << "\"\n";
+    }
+    out << '}';
+}
+
+} // easy_graphs namespace end
+
+#endif // ANIMATION_H
@@ -0,0 +1,447 @@
+#ifndef BIT_MATRIX_GRAPH_H
+#define BIT_MATRIX_GRAPH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define EASY_GRAPHS_AVX2 1
+#endif
+
+#include "adjacency_snapshot.h"
+#include "graph.h"
+#include "graph_builder.h"
+#include "list.h"
+
+namespace easy_graphs {
+
+/*
+  Bitsets of 64 bit words, every row of a BitMatrixGraph is one of them.
+  The number of words is always a multiple of 4, so the AVX2 loops work on
+  whole 256 bit blocks.
+ */
+namespace bits {
+
+inline unsigned popcount(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return unsigned(__builtin_popcountll(word));
+#else
+    word = word - ((word >> 1) & 0x5555555555555555ULL);
+    word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+    word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return unsigned((word * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// Position of the lowest set bit, word must not be 0
+inline unsigned lowestBit(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return unsigned(__builtin_ctzll(word));
+#else
+    unsigned position = 0;
+    while ((word & 1) == 0) {
+        word >>= 1;
+        position++;
+    }
+    return position;
+#endif
+}
+
+// destination |= source
+inline void unite(uint64_t* destination, const uint64_t* source, size_t words) {
+#ifdef EASY_GRAPHS_AVX2
+    for (size_t w = 0; w < words; w += 4) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(destination + w));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + w));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + w),
+                            _mm256_or_si256(a, b));
+    }
+#else
+    for (size_t w = 0; w < words; w++) {
+        destination[w] |= source[w];
+    }
+#endif
+}
+
+// destination &= ~mask, returns true if any bit is left
+inline bool subtract(uint64_t* destination, const uint64_t* mask, size_t words) {
+#ifdef EASY_GRAPHS_AVX2
+    __m256i any = _mm256_setzero_si256();
+    for (size_t w = 0; w < words; w += 4) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(destination + w));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mask + w));
+        __m256i rest = _mm256_andnot_si256(b, a);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + w), rest);
+        any = _mm256_or_si256(any, rest);
+    }
+    return not _mm256_testz_si256(any, any);
+#else
+    uint64_t any = 0;
+    for (size_t w = 0; w < words; w++) {
+        destination[w] &= ~mask[w];
+        any |= destination[w];
+    }
+    return any != 0;
+#endif
+}
+
+// Number of bits set in both a and b
+inline size_t intersectionSize(const uint64_t* a, const uint64_t* b, size_t words) {
+    size_t count = 0;
+    for (size_t w = 0; w < words; w++) {
+        count += popcount(a[w] & b[w]);
+    }
+    return count;
+}
+
+inline bool test(const uint64_t* bitset, size_t bit) {
+    return (bitset[bit >> 6] >> (bit & 63)) & 1;
+}
+
+inline void set(uint64_t* bitset, size_t bit) {
+    bitset[bit >> 6] |= uint64_t(1) << (bit & 63);
+}
+
+inline void reset(uint64_t* bitset, size_t bit) {
+    bitset[bit >> 6] &= ~(uint64_t(1) << (bit & 63));
+}
+
+// Calls found(bit) for every bit set, in increasing order
+template <typename Found>
+void forEach(const uint64_t* bitset, size_t words, Found found) {
+    for (size_t w = 0; w < words; w++) {
+        for (uint64_t word = bitset[w]; word != 0; word &= word - 1) {
+            found((w << 6) + lowestBit(word));
+        }
+    }
+}
+
+} // bits namespace end
+
+/*
+  Unweighted graph stored as a bit packed adjacency matrix, an alternative
+  to Graph<T> for dense graphs of up to some tens of thousands of vertices
+  (16k vertices take 32 MB). The row of a vertex is the bitset of its
+  out-neighbours, so traversals expand a whole row with word wide (AVX2
+  when the compiler targets it) OR and AND-NOT operations instead of
+  following one list node per edge, hasEdge is O(1) and common neighbours
+  are counted with popcounts. Vertices are numbered by insertion order and
+  neighbours are visited by increasing number. Parallel edges can not be
+  represented and weights are dropped.
+  T must be usable as a key of std::unordered_map.
+ */
+template <class T>
+class BitMatrixGraph {
+ public:
+  // Same meaning as the arguments of the constructor of Graph
+  explicit BitMatrixGraph(bool directed,
+                          const std::initializer_list<T>& vertices_ids = {});
+
+  // Copy of the edges of a graph without their weights. Complexity: O(V^2 / 64 + E)
+  explicit BitMatrixGraph(const Graph<T>& graph)
+      : BitMatrixGraph(AdjacencySnapshot<T>(graph)) {}
+
+  explicit BitMatrixGraph(const AdjacencySnapshot<T>& graph);
+
+  bool isDirected() const { return directed; }
+
+  // Number of vertices
+  size_t getDegree() const { return ids.size(); }
+
+  // Complexity: amortized O(V / 64), the matrix doubles when it is full
+  bool newVertex(const T& vertex_id);
+
+  // False if some of the vertices does not exist or the edge is already there
+  bool newEdge(const T& source_id, const T& target_id);
+
+  bool deleteEdge(const T& source_id, const T& target_id);
+
+  // Complexity: O(1)
+  bool hasEdge(const T& source_id, const T& target_id) const;
+
+  /*
+    Spanning trees with the same shape as the ones of Graph::bfs and
+    Graph::dfs: directed, unweighted and empty if the root does not exist
+    or has no neighbours.
+    Complexity: O(V^2 / 64)
+   */
+  Graph<T> bfs(const T& root_id) const;
+  Graph<T> dfs(const T& root_id) const;
+
+  /*
+    Vertices reachable from the root, itself included, in insertion order.
+    Every level of the search is the union of the rows of the frontier.
+    Complexity: O(V^2 / 64)
+   */
+  List<T> reachable(const T& root_id) const;
+
+  // Stops as soon as the target is found
+  bool isReachable(const T& source_id, const T& target_id) const;
+
+  /*
+    Vertices which are out-neighbours of both a and b, and their number.
+    Complexity: O(V / 64)
+   */
+  List<T> commonNeighbors(const T& a_id, const T& b_id) const;
+  size_t countCommonNeighbors(const T& a_id, const T& b_id) const;
+
+  // Unweighted Graph with the same vertices and edges. Complexity: O(V^2 / 64 + E)
+  Graph<T> toGraph() const;
+
+ private:
+  // Index of the vertex with the given id or -1 if it does not exist
+  long indexOf(const T& vertex_id) const {
+    auto it = index.find(vertex_id);
+    return it == index.end() ? -1 : long(it->second);
+  }
+  uint64_t* row(size_t vertex) { return matrix.data() + vertex * stride; }
+  const uint64_t* row(size_t vertex) const { return matrix.data() + vertex * stride; }
+  // Visits the reachable vertices by levels, false as soon as stop(level) is
+  // true; visited holds the vertices reached until then
+  template <typename Stop>
+  bool expand(size_t root, std::vector<uint64_t>& visited, Stop stop) const;
+  // Spanning tree of bfs (breadth) or dfs
+  Graph<T> spanningTree(const T& root_id, bool breadth) const;
+
+  bool directed;
+  std::vector<T> ids;
+  std::unordered_map<T, uint32_t> index;
+  size_t stride = 0; // words of a row, a multiple of 4
+  std::vector<uint64_t> matrix;
+};
+
+// ----------------- IMPLEMENTATION --------------------
+
+template <typename T>
+BitMatrixGraph<T>::BitMatrixGraph(bool directed,
+                                  const std::initializer_list<T>& vertices_ids)
+    : directed(directed) {
+    for (const T& id : vertices_ids) {
+        newVertex(id);
+    }
+}
+
+template <typename T>
+BitMatrixGraph<T>::BitMatrixGraph(const AdjacencySnapshot<T>& graph)
+    : directed(graph.isDirected()) {
+    size_t size = graph.size();
+    stride = (size + 255) / 256 * 4;
+    // Room for stride * 64 rows, the capacity newVertex expects
+    matrix.assign(stride * 64 * stride, 0);
+    ids.reserve(size);
+    for (size_t i = 0; i < size; i++) {
+        ids.push_back(graph.getId(i));
+        index.emplace(graph.getId(i), uint32_t(i));
+    }
+    bool transposed = graph.isTransposed();
+    for (size_t i = 0; i < size; i++) {
+        for (size_t e = graph.rowBegin(i); e < graph.rowEnd(i); e++) {
+            size_t j = graph.target(e);
+            bits::set(row(transposed ? j : i), transposed ? i : j);
+        }
+    }
+}
+
+template <typename T>
+bool BitMatrixGraph<T>::newVertex(const T& vertex_id) {
+    if (index.count(vertex_id) > 0) {
+        return false;
+    }
+    size_t size = ids.size();
+    if (size == stride * 64) {
+        size_t new_stride = stride == 0 ? 4 : stride * 2;
+        std::vector<uint64_t> bigger(new_stride * new_stride * 64, 0);
+        for (size_t i = 0; i < size; i++) {
+            std::copy(row(i), row(i) + stride, bigger.begin() + i * new_stride);
+        }
+        matrix.swap(bigger);
+        stride = new_stride;
+    }
+    index.emplace(vertex_id, uint32_t(size));
+    ids.push_back(vertex_id);
+    return true;
+}
+
+template <typename T>
+bool BitMatrixGraph<T>::newEdge(const T& source_id, const T& target_id) {
+    long source = indexOf(source_id), target = indexOf(target_id);
+    if (source < 0 or target < 0 or bits::test(row(source), target)) {
+        return false;
+    }
+    bits::set(row(source), target);
+    if (not directed) {
+        bits::set(row(target), source);
+    }
+    return true;
+}
+
+template <typename T>
+bool BitMatrixGraph<T>::deleteEdge(const T& source_id, const T& target_id) {
+    long source = indexOf(source_id), target = indexOf(target_id);
+    if (source < 0 or target < 0 or not bits::test(row(source), target)) {
+        return false;
+    }
+    bits::reset(row(source), target);
+    if (not directed) {
+        bits::reset(row(target), source);
+    }
+    return true;
+}
+
+template <typename T>
+bool BitMatrixGraph<T>::hasEdge(const T& source_id, const T& target_id) const {
+    long source = indexOf(source_id), target = indexOf(target_id);
+    return source >= 0 and target >= 0 and bits::test(row(source), target);
+}
+
+template <typename T>
+Graph<T> BitMatrixGraph<T>::bfs(const T& root_id) const {
+    return spanningTree(root_id, true);
+}
+
+template <typename T>
+Graph<T> BitMatrixGraph<T>::dfs(const T& root_id) const {
+    return spanningTree(root_id, false);
+}
+
+template <typename T>
+Graph<T> BitMatrixGraph<T>::spanningTree(const T& root_id, bool breadth) const {
+    GraphBuilder<T> tree(false, true);
+    long root = indexOf(root_id);
+    if (root < 0) {
+        return tree.build();
+    }
+    std::vector<uint64_t> visited(stride, 0), discovered(stride, 0);
+    bits::set(visited.data(), root);
+    // Queue for bfs, stack for dfs; every vertex enters it once
+    std::vector<uint32_t> pending = {uint32_t(root)};
+    std::vector<uint32_t> tree_index(ids.size(), 0);
+    size_t head = 0;
+    while (head < pending.size()) {
+        uint32_t current;
+        if (breadth) {
+            current = pending[head++];
+        } else {
+            current = pending.back();
+            pending.pop_back();
+        }
+        if (current == uint32_t(root)) {
+            // Graph::bfs adds the root only when it has some neighbour
+            bool isolated = true;
+            for (size_t w = 0; w < stride and isolated; w++) {
+                isolated = row(current)[w] == 0;
+            }
+            if (isolated) break;
+            tree_index[current] = tree.addVertex(ids[current]);
+        }
+        std::copy(row(current), row(current) + stride, discovered.begin());
+        if (not bits::subtract(discovered.data(), visited.data(), stride)) {
+            continue;
+        }
+        bits::unite(visited.data(), discovered.data(), stride);
+        bits::forEach(discovered.data(), stride, [&](size_t next) {
+            tree_index[next] = tree.addVertex(ids[next]);
+            tree.addEdgeByIndex(tree_index[current], tree_index[next]);
+            pending.push_back(uint32_t(next));
+        });
+    }
+    return tree.build();
+}
+
+template <typename T>
+template <typename Stop>
+bool BitMatrixGraph<T>::expand(size_t root, std::vector<uint64_t>& visited,
+                               Stop stop) const {
+    visited.assign(stride, 0);
+    std::vector<uint64_t> frontier(stride, 0), next(stride, 0);
+    bits::set(visited.data(), root);
+    bits::set(frontier.data(), root);
+    while (true) {
+        if (stop(frontier)) {
+            return false;
+        }
+        std::fill(next.begin(), next.end(), 0);
+        bits::forEach(frontier.data(), stride, [&](size_t vertex) {
+            bits::unite(next.data(), row(vertex), stride);
+        });
+        if (not bits::subtract(next.data(), visited.data(), stride)) {
+            return true;
+        }
+        bits::unite(visited.data(), next.data(), stride);
+        frontier.swap(next);
+    }
+}
+
+template <typename T>
+List<T> BitMatrixGraph<T>::reachable(const T& root_id) const {
+    List<T> result;
+    long root = indexOf(root_id);
+    if (root >= 0) {
+        std::vector<uint64_t> visited;
+        expand(root, visited, [](const std::vector<uint64_t>&) { return false; });
+        bits::forEach(visited.data(), stride, [&](size_t vertex) {
+            result.append(ids[vertex]);
+        });
+    }
+    return result;
+}
+
+template <typename T>
+bool BitMatrixGraph<T>::isReachable(const T& source_id, const T& target_id) const {
+    long source = indexOf(source_id), target = indexOf(target_id);
+    if (source < 0 or target < 0) {
+        return false;
+    }
+    std::vector<uint64_t> visited;
+    return not expand(source, visited, [&](const std::vector<uint64_t>& frontier) {
+        return bits::test(frontier.data(), target);
+    });
+}
+
+template <typename T>
+List<T> BitMatrixGraph<T>::commonNeighbors(const T& a_id, const T& b_id) const {
+    List<T> result;
+    long a = indexOf(a_id), b = indexOf(b_id);
+    if (a >= 0 and b >= 0) {
+        for (size_t w = 0; w < stride; w++) {
+            for (uint64_t word = row(a)[w] & row(b)[w]; word != 0; word &= word - 1) {
+                result.append(ids[(w << 6) + bits::lowestBit(word)]);
+            }
+        }
+    }
+    return result;
+}
+
+template <typename T>
+size_t BitMatrixGraph<T>::countCommonNeighbors(const T& a_id, const T& b_id) const {
+    long a = indexOf(a_id), b = indexOf(b_id);
+    if (a < 0 or b < 0) {
+        return 0;
+    }
+    return bits::intersectionSize(row(a), row(b), stride);
+}
+
+template <typename T>
+Graph<T> BitMatrixGraph<T>::toGraph() const {
+    GraphBuilder<T> builder(false, directed);
+    for (const T& id : ids) {
+        builder.addVertex(id);
+    }
+    for (size_t i = 0; i < ids.size(); i++) {
+        bits::forEach(row(i), stride, [&](size_t j) {
+            if (directed or j >= i) { // the builder puts undirected edges in both rows
+                builder.addEdgeByIndex(uint32_t(i), uint32_t(j));
+            }
+        });
+    }
+    return builder.build();
+}
+
+} // easy_graphs namespace end
+
+#endif // BIT_MATRIX_GRAPH_H
@@ -0,0 +1,235 @@
+#ifndef CENTRALITY_H
+#define CENTRALITY_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "adjacency_snapshot.h"
+#include "parallel.h"
+
+namespace easy_graphs {
+
+/*
+  Betweenness centrality with the algorithm of Brandes: one single source
+  shortest paths search per source (BFS on unweighted graphs, Dijkstra on
+  weighted ones, whose weights must be positive) followed by the
+  accumulation of the dependencies in reverse order.
+  The sources are shared between num_threads threads (0 = hardware
+  concurrency), each one with its own buffers and scores, added at the end.
+  The result is indexed like the vertices of the snapshot. On undirected
+  graphs every pair is counted once.
+  Complexity: O(V * E) unweighted, O(V * E * log V) weighted
+ */
+template <typename T>
+std::vector<double> betweennessCentrality(const AdjacencySnapshot<T>& graph,
+                                          unsigned num_threads = 0);
+
+/*
+  Approximation of the betweenness centrality using only pivots sources,
+  chosen at random with the given seed, scaled by size() / pivots.
+  With pivots >= size() it is the exact centrality, with no pivots every
+  score is 0 (there is nothing to estimate from).
+  Complexity: O(pivots * E) unweighted, O(pivots * E * log V) weighted
+ */
+template <typename T>
+std::vector<double> approximateBetweennessCentrality(
+    const AdjacencySnapshot<T>& graph, size_t pivots, unsigned seed = 0,
+    unsigned num_threads = 0);
+
+// Same as above but takes the snapshot of the graph first
+template <typename T>
+std::vector<double> betweennessCentrality(const Graph<T>& graph,
+                                          unsigned num_threads = 0) {
+  return betweennessCentrality(AdjacencySnapshot<T>(graph), num_threads);
+}
+
+template <typename T>
+std::vector<double> approximateBetweennessCentrality(
+    const Graph<T>& graph, size_t pivots, unsigned seed = 0,
+    unsigned num_threads = 0) {
+  return approximateBetweennessCentrality(AdjacencySnapshot<T>(graph),
+                                          pivots, seed, num_threads);
+}
+
+// ----------------- IMPLEMENTATION --------------------
+
+namespace brandes {
+
+  // Buffers of one thread, reused between sources
+  struct State {
+    explicit State(size_t size)
+        : distance(size, -1), sigma(size, 0), delta(size, 0),
+          centrality(size, 0) {
+      order.reserve(size);
+    }
+    std::vector<int64_t> distance; // -1 while the vertex is not reached
+    std::vector<double> sigma;     // number of shortest paths from the source
+    std::vector<double> delta;     // dependency of the source on the vertex
+    std::vector<uint32_t> order;   // vertices by non decreasing distance
+    std::vector<double> centrality;
+  };
+
+  template <typename T>
+  void unweightedSearch(const AdjacencySnapshot<T>& graph, uint32_t source,
+                        State& state) {
+    state.distance[source] = 0;
+    state.sigma[source] = 1;
+    state.order.push_back(source);
+    // order doubles as the queue of the BFS
+    for (size_t head = 0; head < state.order.size(); head++) {
+      uint32_t vertex = state.order[head];
+      int64_t next_distance = state.distance[vertex] + 1;
+      for (size_t e = graph.rowBegin(vertex); e < graph.rowEnd(vertex); e++) {
+        uint32_t neighbour = graph.target(e);
+        if (state.distance[neighbour] < 0) {
+          state.distance[neighbour] = next_distance;
+          state.order.push_back(neighbour);
+        }
+        if (state.distance[neighbour] == next_distance) {
+          state.sigma[neighbour] += state.sigma[vertex];
+        }
+      }
+    }
+  }
+
+  template <typename T>
+  void weightedSearch(const AdjacencySnapshot<T>& graph, uint32_t source,
+                      State& state) {
+    typedef std::pair<int64_t, uint32_t> Entry;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+    state.distance[source] = 0;
+    state.sigma[source] = 1;
+    heap.push(Entry(0, source));
+    while (not heap.empty()) {
+      Entry entry = heap.top();
+      heap.pop();
+      uint32_t vertex = entry.second;
+      if (entry.first > state.distance[vertex]) continue; // stale entry
+      state.order.push_back(vertex);
+      for (size_t e = graph.rowBegin(vertex); e < graph.rowEnd(vertex); e++) {
+        uint32_t neighbour = graph.target(e);
+        int64_t candidate = entry.first + graph.weight(e);
+        if (state.distance[neighbour] < 0 or
+            candidate < state.distance[neighbour]) {
+          state.distance[neighbour] = candidate;
+          state.sigma[neighbour] = state.sigma[vertex];
+          heap.push(Entry(candidate, neighbour));
+        } else if (candidate == state.distance[neighbour]) {
+          state.sigma[neighbour] += state.sigma[vertex];
+        }
+      }
+    }
+  }
+
+  template <typename T>
+  void accumulate(const AdjacencySnapshot<T>& graph, uint32_t source,
+                  State& state) {
+    if (graph.isWeighted()) {
+      weightedSearch(graph, source, state);
+    } else {
+      unweightedSearch(graph, source, state);
+    }
+    for (size_t i = state.order.size(); i-- > 0; ) {
+      uint32_t vertex = state.order[i];
+      double coefficient = state.sigma[vertex];
+      double dependency = 0;
+      for (size_t e = graph.rowBegin(vertex); e < graph.rowEnd(vertex); e++) {
+        uint32_t neighbour = graph.target(e);
+        int64_t step = graph.isWeighted() ? graph.weight(e) : 1;
+        if (state.distance[neighbour] == state.distance[vertex] + step) {
+          dependency += coefficient / state.sigma[neighbour]
+                        * (1 + state.delta[neighbour]);
+        }
+      }
+      state.delta[vertex] = dependency;
+      if (vertex != source) {
+        state.centrality[vertex] += dependency;
+      }
+    }
+    for (uint32_t vertex : state.order) {
+      state.distance[vertex] = -1;
+      state.sigma[vertex] = 0;
+      state.delta[vertex] = 0;
+    }
+    state.order.clear();
+  }
+
+  template <typename T>
+  std::vector<double> run(const AdjacencySnapshot<T>& graph,
+                          const std::vector<uint32_t>& sources,
+                          double scale, unsigned num_threads) {
+    size_t size = graph.size();
+    unsigned threads = std::max(1u, std::min<unsigned>(
+        resolveThreadCount(num_threads), unsigned(sources.size())));
+    std::vector<std::unique_ptr<State>> states(threads);
+    std::atomic<size_t> next(0);
+    parallelFor(0, threads, threads, [&](unsigned, size_t lo, size_t hi) {
+      for (size_t t = lo; t < hi; t++) {
+        states[t].reset(new State(size));
+        State* state = states[t].get();
+        for (size_t i = next++; i < sources.size(); i = next++) {
+          accumulate(graph, sources[i], *state);
+        }
+      }
+    }, 1);
+    std::vector<double> centrality(size, 0);
+    if (not graph.isDirected()) {
+      scale /= 2; // both directions of every pair were added
+    }
+    for (const std::unique_ptr<State>& state : states) {
+      if (not state) continue;
+      for (size_t v = 0; v < size; v++) {
+        centrality[v] += state->centrality[v] * scale;
+      }
+    }
+    return centrality;
+  }
+
+} // brandes namespace end
+
+template <typename T>
+std::vector<double> betweennessCentrality(const AdjacencySnapshot<T>& graph,
+                                          unsigned num_threads) {
+  std::vector<uint32_t> sources(graph.size());
+  for (size_t v = 0; v < sources.size(); v++) {
+    sources[v] = uint32_t(v);
+  }
+  return brandes::run(graph, sources, 1.0, num_threads);
+}
+
+template <typename T>
+std::vector<double> approximateBetweennessCentrality(
+    const AdjacencySnapshot<T>& graph, size_t pivots, unsigned seed,
+    unsigned num_threads) {
+  size_t size = graph.size();
+  if (pivots >= size) {
+    return betweennessCentrality(graph, num_threads);
+  }
+  if (pivots == 0) {
+    return std::vector<double>(size, 0.0);
+  }
+  // Partial Fisher-Yates shuffle, the first pivots vertices are the sample
+  std::vector<uint32_t> sources(size);
+  for (size_t v = 0; v < size; v++) {
+    sources[v] = uint32_t(v);
+  }
+  std::mt19937_64 random(seed);
+  for (size_t i = 0; i < pivots; i++) {
+    std::uniform_int_distribution<size_t> pick(i, size - 1);
+    std::swap(sources[i], sources[pick(random)]);
+  }
+  sources.resize(pivots);
+  return brandes::run(graph, sources, double(size) / double(pivots),
+                      num_threads);
+}
+
+} // easy_graphs namespace end
+
+#endif // CENTRALITY_H
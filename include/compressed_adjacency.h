@@ -0,0 +1,420 @@
+#ifndef COMPRESSED_ADJACENCY_H
+#define COMPRESSED_ADJACENCY_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "adjacency_snapshot.h"
+#include "graph.h"
+#include "parallel.h"
+
+namespace easy_graphs {
+
+/*
+  LEB128 variable length integers: 7 bits per byte, the high bit tells if
+  more bytes follow. Small numbers, like the gaps between sorted
+  neighbours, take a single byte.
+ */
+namespace varint {
+
+inline size_t encodedSize(uint64_t value) {
+    size_t size = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        size++;
+    }
+    return size;
+}
+
+inline uint8_t* encode(uint8_t* out, uint64_t value) {
+    while (value >= 0x80) {
+        *out++ = uint8_t(value | 0x80);
+        value >>= 7;
+    }
+    *out++ = uint8_t(value);
+    return out;
+}
+
+inline const uint8_t* decode(const uint8_t* in, uint64_t& value) {
+    if (*in < 0x80) { // the common case of the gaps
+        value = *in;
+        return in + 1;
+    }
+    value = 0;
+    for (unsigned shift = 0; ; shift += 7) {
+        uint8_t byte = *in++;
+        value |= uint64_t(byte & 0x7F) << shift;
+        if (byte < 0x80) return in;
+    }
+}
+
+// Signed numbers with small absolute value as small unsigned ones
+inline uint64_t zigzag(int64_t value) {
+    return (uint64_t(value) << 1) ^ uint64_t(value >> 63);
+}
+
+inline int64_t unzigzag(uint64_t value) {
+    return int64_t(value >> 1) ^ -int64_t(value & 1);
+}
+
+} // varint namespace end
+
+/*
+  Read-only rows of neighbours, sorted and gap encoded as varints: every
+  row is its length followed by the difference between the first neighbour
+  and the vertex itself (zigzag encoded) and then the gaps between
+  consecutive neighbours. Graphs with locality (neighbours with close
+  numbers) take one or two bytes per edge instead of the 4 of a snapshot
+  and the 32 or more of a Graph, in exchange for decoding the rows while
+  they are walked. Parallel edges are kept, as zero gaps.
+ */
+class CompressedRows {
+ public:
+  // Decodes a row, neighbours come by increasing number
+  class Iterator {
+   public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef uint32_t value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const uint32_t* pointer;
+    typedef const uint32_t& reference;
+
+    Iterator() {}
+
+    Iterator(const uint8_t* next, size_t remaining, uint32_t vertex)
+        : next(next), remaining(remaining) {
+      if (remaining > 0) {
+        uint64_t first;
+        this->next = varint::decode(next, first);
+        value = uint32_t(int64_t(vertex) + varint::unzigzag(first));
+      }
+    }
+
+    const uint32_t& operator*() const { return value; }
+
+    Iterator& operator++() {
+      if (--remaining > 0) {
+        uint64_t gap;
+        next = varint::decode(next, gap);
+        value += uint32_t(gap);
+      }
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      Iterator copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    // Only iterators of the same row can be compared
+    bool operator==(const Iterator& other) const { return remaining == other.remaining; }
+    bool operator!=(const Iterator& other) const { return remaining != other.remaining; }
+
+   private:
+    const uint8_t* next = nullptr;
+    size_t remaining = 0;
+    uint32_t value = 0;
+  };
+
+  // Range of the neighbours of a vertex, for range based for loops
+  class Row {
+   public:
+    Row(Iterator first, size_t length) : first(first), length(length) {}
+
+    Iterator begin() const { return first; }
+    Iterator end() const { return Iterator(); }
+    size_t size() const { return length; }
+
+   private:
+    Iterator first;
+    size_t length;
+  };
+
+  CompressedRows() {}
+
+  /*
+    Compresses size rows of compressed sparse rows (offsets with size + 1
+    entries). The rows are sorted on the way, in parallel with num_threads
+    threads (0 = hardware concurrency), each thread in a scratch row of the
+    largest degree it meets.
+    Complexity: O(E log d) work, the compressed bytes twice at the peak
+   */
+  CompressedRows(size_t size, const std::vector<size_t>& offsets,
+                 const std::vector<uint32_t>& targets, unsigned num_threads = 0);
+
+  size_t size() const { return vertices; }
+
+  size_t edgeCount() const { return edges; }
+
+  // Complexity: O(1)
+  size_t degree(size_t vertex) const {
+    uint64_t length;
+    varint::decode(bytes.data() + offsets[vertex], length);
+    return size_t(length);
+  }
+
+  Row row(size_t vertex) const {
+    uint64_t length;
+    const uint8_t* start = varint::decode(bytes.data() + offsets[vertex], length);
+    return Row(Iterator(start, size_t(length), uint32_t(vertex)), size_t(length));
+  }
+
+  // Byte where every row starts, plus the total, a prefix sum of the work
+  const std::vector<size_t>& getOffsets() const { return offsets; }
+
+  // Bytes taken by the rows and their offsets
+  size_t memoryBytes() const {
+    return bytes.capacity() + offsets.capacity() * sizeof(size_t);
+  }
+
+  /*
+    The rows of the in-neighbours, built without decompressing the whole
+    adjacency: one pass to size the new rows and one to encode them.
+    Complexity: O(V + E), with O(V) extra memory
+   */
+  CompressedRows transpose() const;
+
+ private:
+  size_t vertices = 0;
+  size_t edges = 0;
+  std::vector<size_t> offsets = {0};
+  std::vector<uint8_t> bytes;
+};
+
+/*
+  Compressed and read-only copy of the adjacency of a Graph, numbered like
+  AdjacencySnapshot (insertion order). Weights are not kept. It is built
+  from a snapshot, so the uncompressed rows must fit once; the point is
+  to keep a graph that is used for long in a fraction of their memory
+  after dropping them: neighbors(v) decodes a row on the fly and bfs, dfs
+  and PageRank (pagerank.h) work on it directly.
+ */
+template <class T>
+class CompressedAdjacency {
+ public:
+  // Marks the vertices not reached by bfs and dfs in their parents
+  static const uint32_t NO_PARENT = UINT32_MAX;
+
+  CompressedAdjacency() {}
+
+  // Complexity: O(V + E log d)
+  explicit CompressedAdjacency(const AdjacencySnapshot<T>& graph,
+                               unsigned num_threads = 0)
+      : directed(graph.isDirected()), transposed(graph.isTransposed()),
+        ids(graph.getIds()),
+        rows(graph.size(), graph.getOffsets(), graph.getTargets(), num_threads) {}
+
+  explicit CompressedAdjacency(const Graph<T>& graph, unsigned num_threads = 0)
+      : CompressedAdjacency(AdjacencySnapshot<T>(graph), num_threads) {}
+
+  size_t size() const { return ids.size(); }
+
+  size_t edgeCount() const { return rows.edgeCount(); }
+
+  bool isDirected() const { return directed; }
+
+  // If true the rows hold in-neighbours
+  bool isTransposed() const { return transposed; }
+
+  const T& getId(size_t vertex) const { return ids[vertex]; }
+
+  size_t degree(size_t vertex) const { return rows.degree(vertex); }
+
+  // Neighbours of a vertex by increasing number
+  CompressedRows::Row neighbors(size_t vertex) const { return rows.row(vertex); }
+
+  const CompressedRows& getRows() const { return rows; }
+
+  // Bytes taken by the rows, not counting the ids
+  size_t memoryBytes() const { return rows.memoryBytes(); }
+
+  /*
+    Vertices in the order a breadth (depth) first search from root visits
+    them, with the neighbours taken by increasing number like Graph::bfs
+    and Graph::dfs do with the adjacency list. If parents is given it ends
+    with the parent of every vertex in the search tree: root for the root
+    and NO_PARENT for the vertices not reached.
+    Complexity: O(V + E)
+   */
+  std::vector<uint32_t> bfs(size_t root, std::vector<uint32_t>* parents = nullptr) const {
+    return search(root, parents, true);
+  }
+
+  std::vector<uint32_t> dfs(size_t root, std::vector<uint32_t>* parents = nullptr) const {
+    return search(root, parents, false);
+  }
+
+  // Decompressed copy. Complexity: O(V + E)
+  AdjacencySnapshot<T> toSnapshot() const;
+
+ private:
+  std::vector<uint32_t> search(size_t root, std::vector<uint32_t>* parents,
+                               bool breadth) const;
+
+  bool directed = false;
+  bool transposed = false;
+  std::vector<T> ids;
+  CompressedRows rows;
+};
+
+// ----------------- IMPLEMENTATION --------------------
+
+inline CompressedRows::CompressedRows(size_t size, const std::vector<size_t>& row_offsets,
+                                      const std::vector<uint32_t>& targets,
+                                      unsigned num_threads)
+    : vertices(size), edges(row_offsets[size] - row_offsets[0]) {
+    // Every thread sorts its rows one at a time in a scratch row and encodes
+    // them to its own bytes, which go to their place once the offsets are known
+    unsigned threads = resolveThreadCount(num_threads);
+    std::vector<std::vector<uint8_t>> encoded(threads);
+    std::vector<size_t> first_row(threads, 0);
+    offsets.assign(size + 1, 0);
+    parallelForBalanced(0, size, row_offsets, threads,
+                        [&](unsigned thread, size_t lo, size_t hi) {
+        std::vector<uint32_t> row;
+        std::vector<uint8_t>& out = encoded[thread];
+        first_row[thread] = lo;
+        for (size_t v = lo; v < hi; v++) {
+            row.assign(targets.begin() + row_offsets[v], targets.begin() + row_offsets[v + 1]);
+            std::sort(row.begin(), row.end());
+            size_t length = varint::encodedSize(row.size());
+            if (not row.empty()) {
+                length += varint::encodedSize(varint::zigzag(int64_t(row[0]) - int64_t(v)));
+                for (size_t i = 1; i < row.size(); i++) {
+                    length += varint::encodedSize(row[i] - row[i - 1]);
+                }
+            }
+            size_t start = out.size();
+            out.resize(start + length);
+            uint8_t* next = varint::encode(out.data() + start, row.size());
+            if (not row.empty()) {
+                next = varint::encode(next, varint::zigzag(int64_t(row[0]) - int64_t(v)));
+                for (size_t i = 1; i < row.size(); i++) {
+                    next = varint::encode(next, row[i] - row[i - 1]);
+                }
+            }
+            offsets[v + 1] = length;
+        }
+    });
+    for (size_t v = 0; v < size; v++) {
+        offsets[v + 1] += offsets[v];
+    }
+    bytes.resize(offsets[size]);
+    parallelFor(0, threads, threads, [&](unsigned, size_t lo, size_t hi) {
+        for (size_t t = lo; t < hi; t++) {
+            std::copy(encoded[t].begin(), encoded[t].end(),
+                      bytes.begin() + std::ptrdiff_t(offsets[first_row[t]]));
+            std::vector<uint8_t>().swap(encoded[t]);
+        }
+    }, 1);
+}
+
+inline CompressedRows CompressedRows::transpose() const {
+    // Walking the rows by increasing vertex appends it in increasing order
+    // to the rows of its neighbours, which are then sorted as required
+    CompressedRows result;
+    result.vertices = vertices;
+    result.edges = edges;
+    std::vector<size_t> length(vertices, 0);
+    std::vector<uint32_t> last(vertices, 0);
+    std::vector<size_t> bytes_of(vertices, 0);
+    for (size_t v = 0; v < vertices; v++) {
+        for (uint32_t target : row(v)) {
+            if (length[target] == 0) {
+                bytes_of[target] += varint::encodedSize(
+                    varint::zigzag(int64_t(v) - int64_t(target)));
+            } else {
+                bytes_of[target] += varint::encodedSize(uint32_t(v) - last[target]);
+            }
+            length[target]++;
+            last[target] = uint32_t(v);
+        }
+    }
+    result.offsets.assign(vertices + 1, 0);
+    for (size_t v = 0; v < vertices; v++) {
+        result.offsets[v + 1] = result.offsets[v] +
+                                varint::encodedSize(length[v]) + bytes_of[v];
+    }
+    result.bytes.resize(result.offsets[vertices]);
+    // bytes_of becomes the write position of every row
+    for (size_t v = 0; v < vertices; v++) {
+        uint8_t* start = result.bytes.data() + result.offsets[v];
+        bytes_of[v] = size_t(varint::encode(start, length[v]) - result.bytes.data());
+        length[v] = 0;
+    }
+    for (size_t v = 0; v < vertices; v++) {
+        for (uint32_t target : row(v)) {
+            uint8_t* out = result.bytes.data() + bytes_of[target];
+            if (length[target] == 0) {
+                out = varint::encode(out, varint::zigzag(int64_t(v) - int64_t(target)));
+            } else {
+                out = varint::encode(out, uint32_t(v) - last[target]);
+            }
+            length[target]++;
+            last[target] = uint32_t(v);
+            bytes_of[target] = size_t(out - result.bytes.data());
+        }
+    }
+    return result;
+}
+
+template <typename T>
+const uint32_t CompressedAdjacency<T>::NO_PARENT;
+
+template <typename T>
+std::vector<uint32_t> CompressedAdjacency<T>::search(size_t root,
+                                                     std::vector<uint32_t>* parents,
+                                                     bool breadth) const {
+    std::vector<uint32_t> order;
+    std::vector<uint32_t> parent(size(), NO_PARENT);
+    if (root < size()) {
+        // Queue for bfs, stack for dfs; every vertex enters it once
+        std::vector<uint32_t> pending = {uint32_t(root)};
+        parent[root] = uint32_t(root);
+        size_t head = 0;
+        while (head < pending.size()) {
+            uint32_t current;
+            if (breadth) {
+                current = pending[head++];
+            } else {
+                current = pending.back();
+                pending.pop_back();
+            }
+            order.push_back(current);
+            for (uint32_t next : rows.row(current)) {
+                if (parent[next] == NO_PARENT) {
+                    parent[next] = current;
+                    pending.push_back(next);
+                }
+            }
+        }
+    }
+    if (parents != nullptr) {
+        parents->swap(parent);
+    }
+    return order;
+}
+
+template <typename T>
+AdjacencySnapshot<T> CompressedAdjacency<T>::toSnapshot() const {
+    std::vector<size_t> offsets(size() + 1, 0);
+    std::vector<uint32_t> targets;
+    targets.reserve(edgeCount());
+    for (size_t v = 0; v < size(); v++) {
+        for (uint32_t target : rows.row(v)) {
+            targets.push_back(target);
+        }
+        offsets[v + 1] = targets.size();
+    }
+    return AdjacencySnapshot<T>(false, directed, ids, std::move(offsets),
+                                std::move(targets), {}, transposed);
+}
+
+} // easy_graphs namespace end
+
+#endif // COMPRESSED_ADJACENCY_H
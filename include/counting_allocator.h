@@ -0,0 +1,95 @@
+/*
+  Replaces the global operator new and operator delete with versions that
+  count the allocated bytes in AllocationCounter (see memory_usage.h).
+  It defines the operators, so it must be included in exactly one source
+  file of the program. Every block carries a 16 byte header with its size.
+ */
+
+#ifndef COUNTING_ALLOCATOR_H
+#define COUNTING_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "memory_usage.h"
+
+namespace easy_graphs {
+  namespace counting_allocator {
+
+    // Keeps the blocks aligned as malloc does
+    const size_t HEADER = 16;
+
+    inline void* allocate(size_t bytes) noexcept {
+      void* block = std::malloc(bytes + HEADER);
+      if (block == nullptr) return nullptr;
+      *static_cast<size_t*>(block) = bytes;
+      AllocationCounter::allocated(bytes);
+      return static_cast<char*>(block) + HEADER;
+    }
+
+    inline void release(void* pointer) noexcept {
+      if (pointer == nullptr) return;
+      void* block = static_cast<char*>(pointer) - HEADER;
+      AllocationCounter::released(*static_cast<size_t*>(block));
+      std::free(block);
+    }
+
+    inline void* allocateOrThrow(size_t bytes) {
+      while (true) {
+        void* pointer = allocate(bytes);
+        if (pointer != nullptr) return pointer;
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr) throw std::bad_alloc();
+        handler();
+      }
+    }
+
+  } // counting_allocator namespace end
+
+  // easy_graphs namespace end
+}
+
+void* operator new(std::size_t bytes) {
+  return easy_graphs::counting_allocator::allocateOrThrow(bytes);
+}
+
+void* operator new[](std::size_t bytes) {
+  return easy_graphs::counting_allocator::allocateOrThrow(bytes);
+}
+
+void* operator new(std::size_t bytes, const std::nothrow_t&) noexcept {
+  return easy_graphs::counting_allocator::allocate(bytes);
+}
+
+void* operator new[](std::size_t bytes, const std::nothrow_t&) noexcept {
+  return easy_graphs::counting_allocator::allocate(bytes);
+}
+
+void operator delete(void* pointer) noexcept {
+  easy_graphs::counting_allocator::release(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+  easy_graphs::counting_allocator::release(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+  easy_graphs::counting_allocator::release(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+  easy_graphs::counting_allocator::release(pointer);
+}
+
+#if __cpp_sized_deallocation
+void operator delete(void* pointer, std::size_t) noexcept {
+  easy_graphs::counting_allocator::release(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+  easy_graphs::counting_allocator::release(pointer);
+}
+#endif
+
+#endif // COUNTING_ALLOCATOR_H
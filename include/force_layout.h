@@ -0,0 +1,278 @@
+#ifndef FORCE_LAYOUT_H
+#define FORCE_LAYOUT_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "adjacency_snapshot.h"
+#include "graph.h"
+#include "layout.h"
+#include "parallel.h"
+
+namespace easy_graphs {
+
+/*
+  Force directed layout in process (Fruchterman-Reingold): vertices push
+  each other away, edges pull their endpoints together and the moves get
+  shorter every iteration. As in the grid variant of Fruchterman and
+  Reingold, only the vertices closer than two edge lengths push, without
+  a frame the pushes of the whole graph would keep spreading it. They
+  are approximated with a Barnes-Hut quadtree, a group of vertices
+  acts as a single one placed at their center, so an iteration costs
+  O(V log V + E) instead of O(V^2), and the forces on the vertices are
+  computed in parallel. At the end the layout is scaled so that the mean
+  length of the edges is the edge length.
+  The result is a FixedLayout, which io/svg_writer.h draws without any
+  graphviz process and which can also pin the frames of the animations.
+  Directions, weights, self loops and parallel edges are ignored.
+ */
+class ForceLayout {
+ public:
+  ForceLayout() {}
+
+  // 200 by default
+  void setIterations(size_t iterations) { this->iterations = iterations; }
+
+  // Mean length of the edges in the result, in points, 72 by default
+  void setEdgeLength(double edge_length) { this->edge_length = edge_length; }
+
+  /*
+    Barnes-Hut accuracy: a cell of the quadtree is taken as one body when
+    its size divided by its distance is below theta. 0 computes the exact
+    forces, 0.8 by default
+   */
+  void setTheta(double theta) { this->theta = theta; }
+
+  // Threads used for the forces, 0 = hardware concurrency
+  void setThreads(unsigned num_threads) { this->num_threads = num_threads; }
+
+  // The initial positions are random, the same seed gives the same layout
+  void setSeed(uint64_t seed) { this->seed = seed; }
+
+  /*
+    Positions by vertex index, in points, all of them at least half an
+    edge length away from the axes.
+    Complexity: O(iterations * (V log V + E))
+   */
+  template <typename T>
+  void compute(const AdjacencySnapshot<T>& graph, std::vector<double>& x,
+               std::vector<double>& y) const;
+
+  // The vertices as dotRepr names them
+  template <typename T>
+  FixedLayout compute(const AdjacencySnapshot<T>& graph) const;
+
+  template <typename T>
+  FixedLayout compute(const Graph<T>& graph) const {
+    return compute(AdjacencySnapshot<T>(graph));
+  }
+
+ private:
+  // Cell of the quadtree, a leaf holds one vertex (more only at MAX_DEPTH)
+  struct Cell {
+    double x = 0, y = 0;   // center of mass, sums while the tree is built
+    double mass = 0;       // vertices inside
+    double center_x, center_y, half;
+    int32_t child[4] = {-1, -1, -1, -1};
+    int32_t body = -1;     // vertex of a leaf, -1 for inner cells
+  };
+  static const unsigned MAX_DEPTH = 48;
+
+  void buildTree(const std::vector<double>& x, const std::vector<double>& y,
+                 std::vector<Cell>& cells) const;
+  // Repulsion of the vertices closer than the cutoff, added to force
+  void repulsion(size_t vertex, const std::vector<double>& x, const std::vector<double>& y,
+                 const std::vector<Cell>& cells, double& force_x, double& force_y) const;
+
+  size_t iterations = 200;
+  double edge_length = 72;
+  double theta = 0.8;
+  unsigned num_threads = 0;
+  uint64_t seed = 1;
+};
+
+// ----------------- IMPLEMENTATION --------------------
+
+inline void ForceLayout::buildTree(const std::vector<double>& x,
+                                   const std::vector<double>& y,
+                                   std::vector<Cell>& cells) const {
+    cells.clear();
+    Cell root;
+    double min_x = *std::min_element(x.begin(), x.end());
+    double max_x = *std::max_element(x.begin(), x.end());
+    double min_y = *std::min_element(y.begin(), y.end());
+    double max_y = *std::max_element(y.begin(), y.end());
+    root.center_x = (min_x + max_x) / 2;
+    root.center_y = (min_y + max_y) / 2;
+    root.half = std::max(max_x - min_x, max_y - min_y) / 2 + 1;
+    cells.push_back(root);
+    auto quadrant = [&](int32_t cell, double px, double py) {
+        return (px >= cells[cell].center_x ? 1 : 0) + (py >= cells[cell].center_y ? 2 : 0);
+    };
+    // Indices instead of references, push_back moves the cells
+    auto childOf = [&](int32_t cell, int q) {
+        if (cells[cell].child[q] < 0) {
+            Cell child;
+            child.half = cells[cell].half / 2;
+            child.center_x = cells[cell].center_x + (q & 1 ? child.half : -child.half);
+            child.center_y = cells[cell].center_y + (q & 2 ? child.half : -child.half);
+            cells[cell].child[q] = int32_t(cells.size());
+            cells.push_back(child);
+        }
+        return cells[cell].child[q];
+    };
+    for (size_t v = 0; v < x.size(); v++) {
+        int32_t cell = 0;
+        for (unsigned depth = 0; ; depth++) {
+            if (cells[cell].mass == 0) {
+                cells[cell].body = int32_t(v);
+                cells[cell].x = x[v];
+                cells[cell].y = y[v];
+                cells[cell].mass = 1;
+                break;
+            }
+            int32_t old = cells[cell].body;
+            if (old >= 0 and depth < MAX_DEPTH) { // the leaf becomes an inner cell
+                cells[cell].body = -1;
+                int32_t child = childOf(cell, quadrant(cell, x[old], y[old]));
+                cells[child].body = old;
+                cells[child].x = x[old];
+                cells[child].y = y[old];
+                cells[child].mass = 1;
+            }
+            cells[cell].x += x[v];
+            cells[cell].y += y[v];
+            cells[cell].mass += 1;
+            if (cells[cell].body >= 0) break; // MAX_DEPTH reached, the leaf keeps both
+            cell = childOf(cell, quadrant(cell, x[v], y[v]));
+        }
+    }
+    for (Cell& cell : cells) {
+        cell.x /= cell.mass;
+        cell.y /= cell.mass;
+    }
+}
+
+inline void ForceLayout::repulsion(size_t vertex, const std::vector<double>& x,
+                                   const std::vector<double>& y,
+                                   const std::vector<Cell>& cells,
+                                   double& force_x, double& force_y) const {
+    const double k2 = edge_length * edge_length;
+    const double cutoff2 = 4 * k2;
+    int32_t stack[4 * MAX_DEPTH + 4];
+    size_t top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        const Cell& cell = cells[stack[--top]];
+        // Nothing of a cell wholly beyond the cutoff pushes
+        double out_x = std::max(0.0, std::fabs(x[vertex] - cell.center_x) - cell.half);
+        double out_y = std::max(0.0, std::fabs(y[vertex] - cell.center_y) - cell.half);
+        if (out_x * out_x + out_y * out_y > cutoff2) continue;
+        double dx = x[vertex] - cell.x;
+        double dy = y[vertex] - cell.y;
+        double distance2 = dx * dx + dy * dy;
+        bool leaf = cell.body >= 0;
+        if (leaf and cell.body == int32_t(vertex) and cell.mass == 1) continue;
+        if (leaf or 4 * cell.half * cell.half < theta * theta * distance2) {
+            if (distance2 < 1e-12 or distance2 > cutoff2) continue; // no direction, or too far
+            // Magnitude k^2 / d along (dx, dy) / d
+            double scale = cell.mass * k2 / distance2;
+            force_x += dx * scale;
+            force_y += dy * scale;
+        } else {
+            for (int q = 0; q < 4; q++) {
+                if (cell.child[q] >= 0) stack[top++] = cell.child[q];
+            }
+        }
+    }
+}
+
+template <typename T>
+void ForceLayout::compute(const AdjacencySnapshot<T>& graph, std::vector<double>& x,
+                          std::vector<double>& y) const {
+    AdjacencySnapshot<T> simple = graph.simplified();
+    size_t size = simple.size();
+    x.assign(size, 0);
+    y.assign(size, 0);
+    if (size == 0) return;
+    double side = edge_length * std::sqrt(double(size));
+    std::mt19937_64 random(seed);
+    std::uniform_real_distribution<double> coordinate(0, side);
+    for (size_t v = 0; v < size; v++) {
+        x[v] = coordinate(random);
+        y[v] = coordinate(random);
+    }
+    std::vector<double> move_x(size), move_y(size);
+    std::vector<Cell> cells;
+    unsigned threads = resolveThreadCount(num_threads);
+    for (size_t iteration = 0; iteration < iterations; iteration++) {
+        // The longest move shrinks linearly from a tenth of the side to 0
+        double temperature = side / 10 * double(iterations - iteration) / double(iterations);
+        buildTree(x, y, cells);
+        parallelFor(0, size, threads, [&](unsigned, size_t lo, size_t hi) {
+            for (size_t v = lo; v < hi; v++) {
+                double force_x = 0, force_y = 0;
+                repulsion(v, x, y, cells, force_x, force_y);
+                // Attraction of magnitude d^2 / k along the edge
+                for (size_t e = simple.rowBegin(v); e < simple.rowEnd(v); e++) {
+                    uint32_t u = simple.target(e);
+                    double dx = x[u] - x[v];
+                    double dy = y[u] - y[v];
+                    double distance = std::sqrt(dx * dx + dy * dy);
+                    force_x += dx * distance / edge_length;
+                    force_y += dy * distance / edge_length;
+                }
+                double length = std::sqrt(force_x * force_x + force_y * force_y);
+                double step = length > temperature ? temperature / length : 1;
+                move_x[v] = force_x * step;
+                move_y[v] = force_y * step;
+            }
+        }, 256);
+        for (size_t v = 0; v < size; v++) {
+            x[v] += move_x[v];
+            y[v] += move_y[v];
+        }
+    }
+    // The forces balance at some multiple of the edge length, which
+    // depends on the graph, the scale makes it the edge length
+    double total = 0;
+    size_t edges = 0;
+    for (size_t v = 0; v < size; v++) {
+        for (size_t e = simple.rowBegin(v); e < simple.rowEnd(v); e++) {
+            uint32_t u = simple.target(e);
+            if (u != v) {
+                total += std::sqrt((x[u] - x[v]) * (x[u] - x[v]) + (y[u] - y[v]) * (y[u] - y[v]));
+                edges++;
+            }
+        }
+    }
+    double scale = edges > 0 and total > 0 ? edge_length * double(edges) / total : 1;
+    double min_x = *std::min_element(x.begin(), x.end());
+    double min_y = *std::min_element(y.begin(), y.end());
+    for (size_t v = 0; v < size; v++) {
+        x[v] = (x[v] - min_x) * scale + edge_length / 2;
+        y[v] = (y[v] - min_y) * scale + edge_length / 2;
+    }
+}
+
+template <typename T>
+FixedLayout ForceLayout::compute(const AdjacencySnapshot<T>& graph) const {
+    std::vector<double> x, y;
+    compute(graph, x, y);
+    FixedLayout layout;
+    for (size_t v = 0; v < graph.size(); v++) {
+        std::ostringstream name;
+        name << graph.getId(v);
+        layout.setPosition(name.str(), x[v], y[v]);
+    }
+    return layout;
+}
+
+} // easy_graphs namespace end
+
+#endif // FORCE_LAYOUT_H
@@ -0,0 +1,509 @@
+#ifndef GENERATORS_H
+#define GENERATORS_H
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "adjacency_snapshot.h"
+#include "graph_builder.h"
+#include "parallel.h"
+#include "io/binary_graph.h"
+
+namespace easy_graphs {
+
+/*
+  Seeded generators of large synthetic graphs, with vertices 0 .. n - 1.
+  A generator splits its work in independent units (an edge, or a vertex
+  and its edges) and every unit draws from its own random stream, made
+  from the seed and the number of the unit. So the units can be generated
+  by any number of threads, in any order, and the graph only depends on
+  the seed. Nothing is kept per edge: the drivers at the end of the file
+  stream the edges into a GraphBuilder, a snapshot or a binary file.
+
+  Every generator has:
+    size_t vertexCount() const
+    uint64_t units() const
+    void generate(uint64_t unit, Emit& emit) const, which calls
+      emit(source, target, weight) for each edge of the unit
+  Edges are undirected by nature, the drivers store them as the builder
+  or the directed argument say. Self loops and parallel edges are not
+  filtered out, see AdjacencySnapshot::simplified.
+ */
+
+// Random numbers of one unit: SplitMix64 started from (seed, unit)
+class UnitRandom {
+ public:
+  UnitRandom(uint64_t seed, uint64_t unit)
+      : state(mix(seed ^ mix(unit + 0x632BE59BD9B4E019ULL))) {}
+
+  uint64_t next() {
+    state += 0x9E3779B97F4A7C15ULL;
+    return mix(state);
+  }
+
+  // Uniform in [0, bound), bound > 0
+  uint32_t below(uint32_t bound) { return uint32_t(((next() >> 32) * bound) >> 32); }
+
+  uint64_t below64(uint64_t bound) { return next() % bound; }
+
+  // Uniform in [0, 1)
+  double real() { return double(next() >> 11) * (1.0 / 9007199254740992.0); }
+
+ private:
+  static uint64_t mix(uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+  }
+
+  uint64_t state;
+};
+
+// Seed and weights shared by the generators
+class GeneratorBase {
+ public:
+  void setSeed(uint64_t seed) { this->seed = seed; }
+
+  // Uniform weights in [min_weight, max_weight], without it every edge has weight 1
+  void setWeights(int min_weight, int max_weight) {
+    weighted = true;
+    this->min_weight = min_weight;
+    this->max_weight = std::max(min_weight, max_weight);
+  }
+
+  bool isWeighted() const { return weighted; }
+
+ protected:
+  int weight(UnitRandom& random) const {
+    if (not weighted) return 1;
+    return min_weight + int(random.below(uint32_t(max_weight - min_weight) + 1));
+  }
+
+  uint64_t seed = 1;
+  bool weighted = false;
+  int min_weight = 1;
+  int max_weight = 1;
+};
+
+/*
+  R-MAT: every edge goes down scale levels of the adjacency matrix, picking
+  one of its four quadrants with probabilities a, b, c and 1 - a - b - c.
+  The Graph500 probabilities by default, a Kronecker graph of the 2x2
+  initiator. One unit per edge.
+ */
+class RmatGenerator : public GeneratorBase {
+ public:
+  RmatGenerator(unsigned scale, uint64_t edge_factor = 16, double a = 0.57,
+                double b = 0.19, double c = 0.19)
+      : scale(scale), edges(edge_factor << scale), a(a), ab(a + b), abc(a + b + c) {}
+
+  size_t vertexCount() const { return size_t(1) << scale; }
+
+  uint64_t units() const { return edges; }
+
+  template <typename Emit>
+  void generate(uint64_t unit, Emit& emit) const {
+    UnitRandom random(seed, unit);
+    uint32_t source = 0, target = 0;
+    for (unsigned bit = 0; bit < scale; bit++) {
+      double p = random.real();
+      if (p >= abc) {
+        source |= uint32_t(1) << bit;
+        target |= uint32_t(1) << bit;
+      } else if (p >= ab) {
+        source |= uint32_t(1) << bit;
+      } else if (p >= a) {
+        target |= uint32_t(1) << bit;
+      }
+    }
+    emit(source, target, weight(random));
+  }
+
+ private:
+  unsigned scale;
+  uint64_t edges;
+  double a, ab, abc;
+};
+
+// G(n, m): m edges between two different uniform vertices. One unit per edge.
+class ErdosRenyiGenerator : public GeneratorBase {
+ public:
+  ErdosRenyiGenerator(size_t vertices, uint64_t edges) : vertices(vertices), edges(edges) {}
+
+  size_t vertexCount() const { return vertices; }
+
+  uint64_t units() const { return vertices < 2 ? 0 : edges; }
+
+  template <typename Emit>
+  void generate(uint64_t unit, Emit& emit) const {
+    UnitRandom random(seed, unit);
+    uint32_t source = random.below(uint32_t(vertices));
+    uint32_t target = random.below(uint32_t(vertices - 1));
+    if (target >= source) target++;
+    emit(source, target, weight(random));
+  }
+
+ private:
+  size_t vertices;
+  uint64_t edges;
+};
+
+/*
+  Barabasi-Albert preferential attachment: vertex v arrives with m edges
+  whose ends are chosen with probability proportional to the degrees.
+  It is the copy model of Batagelj and Brandes: the end of edge e copies
+  an end of a uniform earlier edge, and as every edge has its own random
+  stream the copied end is found by following the copies back, without
+  the edges before it (expected O(1) steps).
+  One unit per edge, the first edge is a self loop of vertex 0.
+ */
+class BarabasiAlbertGenerator : public GeneratorBase {
+ public:
+  BarabasiAlbertGenerator(size_t vertices, uint32_t edges_per_vertex)
+      : vertices(vertices), m(std::max<uint32_t>(1, edges_per_vertex)) {}
+
+  size_t vertexCount() const { return vertices; }
+
+  uint64_t units() const { return uint64_t(vertices) * m; }
+
+  template <typename Emit>
+  void generate(uint64_t unit, Emit& emit) const {
+    UnitRandom random(seed, unit);
+    // The ends of all the edges in a row: edge k is at 2k (its source,
+    // vertex k / m) and 2k + 1 (its target, a copy of an earlier end)
+    uint64_t position = random.below64(2 * unit + 1);
+    while (position % 2 == 1) {
+      uint64_t copied = position / 2;
+      position = UnitRandom(seed, copied).below64(2 * copied + 1);
+    }
+    emit(uint32_t(unit / m), uint32_t(position / 2 / m), weight(random));
+  }
+
+ private:
+  size_t vertices;
+  uint32_t m;
+};
+
+/*
+  Watts-Strogatz small world: a ring where every vertex is joined to the
+  k / 2 next ones, and every edge gets, with probability beta, a uniform
+  other vertex as its second end. One unit per edge of the ring.
+ */
+class WattsStrogatzGenerator : public GeneratorBase {
+ public:
+  WattsStrogatzGenerator(size_t vertices, uint32_t k, double beta)
+      : vertices(vertices), half(std::max<uint32_t>(1, k / 2)), beta(beta) {}
+
+  size_t vertexCount() const { return vertices; }
+
+  uint64_t units() const { return vertices <= half ? 0 : uint64_t(vertices) * half; }
+
+  template <typename Emit>
+  void generate(uint64_t unit, Emit& emit) const {
+    UnitRandom random(seed, unit);
+    uint32_t source = uint32_t(unit / half);
+    uint32_t target = uint32_t((source + unit % half + 1) % vertices);
+    if (random.real() < beta) {
+      target = random.below(uint32_t(vertices - 1));
+      if (target >= source) target++;
+    }
+    emit(source, target, weight(random));
+  }
+
+ private:
+  size_t vertices;
+  uint32_t half;
+  double beta;
+};
+
+/*
+  Random geometric graph: uniform points of the unit square joined when
+  they are at most radius apart. The points are bucketed in square cells
+  of side radius or more, so a vertex is only compared with the points
+  of the cells around it. O(V) memory for the points, which come from
+  the seed of the constructor (setSeed only changes the weights).
+  One unit per vertex, with its edges to the vertices of higher index.
+ */
+class RandomGeometricGenerator : public GeneratorBase {
+ public:
+  RandomGeometricGenerator(size_t vertices, double radius, uint64_t seed = 1);
+
+  size_t vertexCount() const { return xs.size(); }
+
+  uint64_t units() const { return xs.size(); }
+
+  // Position of a vertex in the unit square
+  double getX(size_t vertex) const { return xs[vertex]; }
+  double getY(size_t vertex) const { return ys[vertex]; }
+
+  template <typename Emit>
+  void generate(uint64_t unit, Emit& emit) const;
+
+ private:
+  size_t cellOf(double coordinate) const {
+    return std::min(cells - 1, size_t(coordinate * double(cells)));
+  }
+
+  double radius;
+  size_t cells; // per side
+  std::vector<double> xs, ys;
+  std::vector<size_t> cell_starts;     // cells * cells + 1
+  std::vector<uint32_t> cell_vertices; // by cell, increasing in each cell
+};
+
+/*
+  Grid of rows x columns vertices, vertex r * columns + c joined to the
+  next one of its row and of its column, e.g. as a road network with
+  random lengths. One unit per vertex.
+ */
+class GridGenerator : public GeneratorBase {
+ public:
+  GridGenerator(size_t rows, size_t columns) : rows(rows), columns(columns) {}
+
+  size_t vertexCount() const { return rows * columns; }
+
+  uint64_t units() const { return rows * columns; }
+
+  template <typename Emit>
+  void generate(uint64_t unit, Emit& emit) const {
+    UnitRandom random(seed, unit);
+    uint32_t vertex = uint32_t(unit);
+    if ((unit + 1) % columns != 0) emit(vertex, vertex + 1, weight(random));
+    if (unit / columns + 1 < rows) emit(vertex, uint32_t(vertex + columns), weight(random));
+  }
+
+ private:
+  size_t rows;
+  size_t columns;
+};
+
+/*
+  Adds the vertices, with ids T(0) .. T(n - 1), and the edges of the
+  generator to a builder. The units are generated in parallel by blocks
+  and the blocks are appended in order, so the builder gets the same
+  edges in the same order with any number of threads, and only a few
+  blocks of edges are held besides the builder.
+  Complexity: O(V + E) work
+ */
+template <typename T, typename Generator>
+void generate(const Generator& generator, GraphBuilder<T>& builder, unsigned num_threads = 0);
+
+/*
+  The graph as a snapshot, built with two runs of the generator (one to
+  count the degrees and one to place the edges), so no list of edges is
+  ever held. Every row is sorted by target (and weight), which makes the
+  snapshot the same with any number of threads. Undirected edges are in
+  both rows.
+  Complexity: O(V + E log d) work, O(V) memory besides the snapshot
+ */
+template <typename T = int, typename Generator>
+AdjacencySnapshot<T> generateSnapshot(const Generator& generator, bool directed = false,
+                                      unsigned num_threads = 0);
+
+// The snapshot of generateSnapshot in the binary format of io/binary_graph.h
+template <typename T = int, typename Generator>
+bool writeGeneratedGraph(const std::string& path, const Generator& generator,
+                         bool directed = false, unsigned num_threads = 0) {
+  return writeBinaryGraph(path, generateSnapshot<T>(generator, directed, num_threads));
+}
+
+// ----------------- IMPLEMENTATION --------------------
+
+inline RandomGeometricGenerator::RandomGeometricGenerator(size_t vertices, double radius,
+                                                          uint64_t seed)
+    : radius(radius), xs(vertices), ys(vertices) {
+    this->seed = seed;
+    // Cells of side at least radius, and not many more than the points
+    double per_side = radius > 0 ? std::floor(1 / radius) : 1;
+    double most = std::ceil(std::sqrt(double(vertices))) + 1;
+    cells = size_t(std::max(1.0, std::min(per_side, most)));
+    cell_starts.assign(cells * cells + 1, 0);
+    std::vector<size_t> cell(vertices);
+    for (size_t v = 0; v < vertices; v++) {
+        UnitRandom random(seed, v);
+        xs[v] = random.real();
+        ys[v] = random.real();
+        cell[v] = cellOf(ys[v]) * cells + cellOf(xs[v]);
+        cell_starts[cell[v] + 1]++;
+    }
+    for (size_t c = 0; c < cells * cells; c++) {
+        cell_starts[c + 1] += cell_starts[c];
+    }
+    cell_vertices.resize(vertices);
+    std::vector<size_t> next(cell_starts.begin(), cell_starts.end() - 1);
+    for (size_t v = 0; v < vertices; v++) {
+        cell_vertices[next[cell[v]]++] = uint32_t(v);
+    }
+}
+
+template <typename Emit>
+void RandomGeometricGenerator::generate(uint64_t unit, Emit& emit) const {
+    UnitRandom random(seed ^ 0x5851F42D4C957F2DULL, unit); // not the stream of the points
+    size_t vertex = size_t(unit);
+    size_t row = cellOf(ys[vertex]), column = cellOf(xs[vertex]);
+    double radius2 = radius * radius;
+    for (size_t r = row == 0 ? 0 : row - 1; r <= std::min(cells - 1, row + 1); r++) {
+        for (size_t c = column == 0 ? 0 : column - 1; c <= std::min(cells - 1, column + 1); c++) {
+            size_t cell = r * cells + c;
+            for (size_t i = cell_starts[cell]; i < cell_starts[cell + 1]; i++) {
+                uint32_t other = cell_vertices[i];
+                if (other <= vertex) continue;
+                double dx = xs[other] - xs[vertex], dy = ys[other] - ys[vertex];
+                if (dx * dx + dy * dy <= radius2) {
+                    emit(uint32_t(vertex), other, weight(random));
+                }
+            }
+        }
+    }
+}
+
+namespace generators {
+
+  // Units generated together, and blocks handed to the threads at once
+  const uint64_t BLOCK_UNITS = 1 << 14;
+  const size_t BLOCKS_PER_THREAD = 4;
+
+  struct EdgeBlock {
+    std::vector<uint32_t> sources;
+    std::vector<uint32_t> targets;
+    std::vector<int> weights;
+
+    void operator()(uint32_t source, uint32_t target, int weight) {
+      sources.push_back(source);
+      targets.push_back(target);
+      weights.push_back(weight);
+    }
+
+    void clear() {
+      sources.clear();
+      targets.clear();
+      weights.clear();
+    }
+  };
+
+} // generators namespace end
+
+template <typename T, typename Generator>
+void generate(const Generator& generator, GraphBuilder<T>& builder, unsigned num_threads) {
+    using namespace generators;
+    size_t vertices = generator.vertexCount();
+    std::vector<uint32_t> index(vertices);
+    for (size_t v = 0; v < vertices; v++) {
+        index[v] = builder.addVertex(T(v));
+    }
+    unsigned threads = resolveThreadCount(num_threads);
+    std::vector<EdgeBlock> blocks(threads * BLOCKS_PER_THREAD);
+    uint64_t units = generator.units();
+    uint64_t window = blocks.size() * BLOCK_UNITS;
+    for (uint64_t first = 0; first < units; first += window) {
+        size_t used = size_t((std::min(units - first, window) + BLOCK_UNITS - 1) / BLOCK_UNITS);
+        parallelForDynamic(0, used, threads, [&](unsigned, size_t lo, size_t hi) {
+            for (size_t b = lo; b < hi; b++) {
+                EdgeBlock& block = blocks[b];
+                block.clear();
+                uint64_t begin = first + b * BLOCK_UNITS;
+                uint64_t end = std::min(units, begin + BLOCK_UNITS);
+                for (uint64_t unit = begin; unit < end; unit++) {
+                    generator.generate(unit, block);
+                }
+                for (uint32_t& source : block.sources) source = index[source];
+                for (uint32_t& target : block.targets) target = index[target];
+            }
+        }, 1);
+        for (size_t b = 0; b < used; b++) {
+            if (generator.isWeighted()) {
+                builder.appendEdges(blocks[b].sources, blocks[b].targets, blocks[b].weights);
+            } else {
+                builder.appendEdges(blocks[b].sources, blocks[b].targets);
+            }
+        }
+    }
+}
+
+template <typename T, typename Generator>
+AdjacencySnapshot<T> generateSnapshot(const Generator& generator, bool directed,
+                                      unsigned num_threads) {
+    size_t vertices = generator.vertexCount();
+    uint64_t units = generator.units();
+    bool weighted = generator.isWeighted();
+    unsigned threads = resolveThreadCount(num_threads);
+    const size_t GRAIN = 1 << 12;
+
+    // Run 1: entries of every row
+    std::unique_ptr<std::atomic<size_t>[]> next(new std::atomic<size_t>[vertices]);
+    for (size_t v = 0; v < vertices; v++) {
+        next[v].store(0, std::memory_order_relaxed);
+    }
+    parallelForDynamic(0, size_t(units), threads, [&](unsigned, size_t lo, size_t hi) {
+        auto count = [&](uint32_t source, uint32_t target, int) {
+            next[source].fetch_add(1, std::memory_order_relaxed);
+            if (not directed) next[target].fetch_add(1, std::memory_order_relaxed);
+        };
+        for (size_t unit = lo; unit < hi; unit++) {
+            generator.generate(unit, count);
+        }
+    }, GRAIN);
+    std::vector<size_t> offsets(vertices + 1, 0);
+    for (size_t v = 0; v < vertices; v++) {
+        offsets[v + 1] = offsets[v] + next[v].load(std::memory_order_relaxed);
+        next[v].store(offsets[v], std::memory_order_relaxed);
+    }
+
+    // Run 2: every entry to a free place of its row
+    std::vector<uint32_t> targets(offsets[vertices]);
+    std::vector<int> weights(weighted ? targets.size() : 0);
+    parallelForDynamic(0, size_t(units), threads, [&](unsigned, size_t lo, size_t hi) {
+        auto place = [&](uint32_t source, uint32_t target, int weight) {
+            size_t forward = next[source].fetch_add(1, std::memory_order_relaxed);
+            targets[forward] = target;
+            if (weighted) weights[forward] = weight;
+            if (not directed) {
+                size_t backward = next[target].fetch_add(1, std::memory_order_relaxed);
+                targets[backward] = source;
+                if (weighted) weights[backward] = weight;
+            }
+        };
+        for (size_t unit = lo; unit < hi; unit++) {
+            generator.generate(unit, place);
+        }
+    }, GRAIN);
+    next.reset();
+
+    // The order of the rows depended on the threads, sorting fixes it
+    parallelForBalanced(0, vertices, offsets, threads, [&](unsigned, size_t lo, size_t hi) {
+        std::vector<std::pair<uint32_t, int>> row;
+        for (size_t v = lo; v < hi; v++) {
+            if (not weighted) {
+                std::sort(targets.begin() + offsets[v], targets.begin() + offsets[v + 1]);
+                continue;
+            }
+            row.clear();
+            for (size_t e = offsets[v]; e < offsets[v + 1]; e++) {
+                row.emplace_back(targets[e], weights[e]);
+            }
+            std::sort(row.begin(), row.end());
+            for (size_t e = offsets[v]; e < offsets[v + 1]; e++) {
+                targets[e] = row[e - offsets[v]].first;
+                weights[e] = row[e - offsets[v]].second;
+            }
+        }
+    });
+
+    std::vector<T> ids(vertices);
+    for (size_t v = 0; v < vertices; v++) {
+        ids[v] = T(v);
+    }
+    return AdjacencySnapshot<T>(weighted, directed, std::move(ids), std::move(offsets),
+                                std::move(targets), std::move(weights));
+}
+
+} // easy_graphs namespace end
+
+#endif // GENERATORS_H
@@ -1,646 +1,1717 @@
-#ifndef GRAPH_H
-#define GRAPH_H
-
-#include <vector>
-#include <algorithm>
-#include <ostream>
-#include <sstream>
-#include <cstddef>
-
-#include "vertex.h"
-#include "neighbor_vertex.h"
-#include "heap.h"
-
-namespace easy_graphs {
-
-enum class GraphDrawingMode {
-    DEFAULT,
-    SHOW_DISTANCES
-};
-
-typedef std::vector<std::vector<int>> AdjacencyMatrix;
-
-template<class T>
-class Graph {
- public:
-    // Constructors
-
-  /*
-    Copy constructor
-    Complexity: Linear on the number of other.vertices plus 
-                the number of neighbors of each vertex in other.vertices
-   */
-  Graph(const Graph& other);
-  /*
-    Move constructor
-    Complexity : Constant - Yeah!
-   */
-  Graph(Graph&& other);
-  /*
-    Initializer constructor: Defines the characteristics of the graph
-    @param weighted Especifies if the graph is weighted
-    @param directed Especifies if the graph is directed
-    @param vertices_ids (optional) Initial vertices of the graph  
-   */
-	Graph(bool weighted, bool directed, 
-        const std::initializer_list<T>& vertices_ids = {});
-  /*
-    Copy assign
-    Complexity : Linear on the number of other.vertices plus 
-                 the number of neighbors of each vertex in other.vertices
-                 plus the cost of clean up the current adjacency matrix
-   */
-  Graph& operator=(const Graph& other);
-  /*
-    Move assign
-    Complexity : Cost of clean up the current adjacency matrix
-   */
-  Graph& operator=(Graph&& other);
-  
-  // Methods for modifying the graph:
-
-  bool newVertex(const T& vertex_id);
-  bool deleteVertex(const T& vertex_id);
-  bool newEdge(const T& source_id, const T& target_id, int weight = 1);
-  bool deleteEdge(const T& source_id, const T& target_id);
-
-  /*
-    Deletes all the neighbour vertices of the given vertex 
-    Complexity : Cost of a linear seach through the vertices plus
-                 the number of neighbors to destroy 
-   */
-  bool clearVertex(const T& vertex_id) {
-    return clearVertex(Vertex<T>(vertex_id));
-  }
-
-  /*
-    Deletes every vertex in the graph
-    All vertex has its own list of neighbors which are destroied also
-   */
-  void clearAll() {
-    vertices.clear();
-    degree = 0;
-  }
-
-  /* 
-    Method to read an adjacency matrix wich has to have the same rank as
-    the degree of the graph
-   */
-  bool readAdjacencyMatrix(const AdjacencyMatrix& adjacencyMatrix);
-
-  /*
-    Method to obtain the adjacancy matrix of the current graph
-    The order in which appear the elements of the matrix, is the order
-    in which are the element in the adjacency list
-   */
-  AdjacencyMatrix obtainAdjacencyMatrix();
-
-  // Useful method to obtaing the dot description of the graph 
-  std::string dotRepr(GraphDrawingMode drawing_mode = 
-          GraphDrawingMode::DEFAULT) const;
-
-  // The returned string contains all vertices followed by their neighbors
-  std::string str() const {
-    std::ostringstream ss;
-    for (const Vertex<T>& vertex : vertices) {
-        ss << vertex.str() << std::endl;
-    }
-    return ss.str();
-  }
-  
-  Graph bfs(const T& root_id) {
-    Graph resulting_tree(false, true);
-    auto it = getIteratorOf(root_id);
-    if (it != end(vertices)) {
-      bfs(&(*it), resulting_tree);
-    }
-    return resulting_tree;
-  }
-
-  Graph dfs(const T& root_id) {
-    Graph resulting_tree(false, true);
-    auto it = getIteratorOf(root_id);
-    if (it != end(vertices)) {
-      dfs(&(*it), resulting_tree);
-    }
-    return resulting_tree;
-  }
-
-  Graph prim(const T& root_id) {
-    Graph min_expansion_tree(true, true);
-    auto it = getIteratorOf(root_id);
-    if (it != end(vertices)) {
-      prim(&(*it), min_expansion_tree);
-    }
-    return min_expansion_tree;
-  }
-
-  void dijkstra(const T& source_id) {
-    auto it = getIteratorOf(source_id);
-    if (it != end(vertices)) {
-      resetVerticesFields();
-      dijkstra(&(*it));
-    }
-  }
-
-  List<T> dijkstra(const T& source_id, const T& target_id, int& distance) {
-    auto s_it = getIteratorOf(source_id);
-    auto t_it = getIteratorOf(target_id);
-    if (s_it != end(vertices) and t_it != end(vertices)) {
-      resetVerticesFields();
-      List<T> path;
-      distance = dijkstra(&(*s_it), &(*t_it), path);
-      return path;
-    }
-    distance = -2; // source_id or target_id do not exist
-    return {};
-  }
-
-  List<std::string> bfs_animation(const T& root_id) {
-    List<std::string> animation;
-    auto it = getIteratorOf(root_id);
-    if (it != end(vertices)) {
-      bfs_animation(&(*it), animation);
-    }
-    return animation;
-  }
-
-  List<std::string> dfs_animation(const T& root_id) {
-    List<std::string> animation;
-    auto it = getIteratorOf(root_id);
-    if (it != end(vertices)) {
-      dfs_animation(&(*it), animation);
-    }
-    return animation;
-  }
-
-  List<std::string> dijkstra_animation(const T& source_id) {
-    List<std::string> animation;
-    auto it = getIteratorOf(source_id);
-    if (it != end(vertices)) {
-      resetVerticesFields();
-      dijkstra_animation(&(*it), animation);
-    }
-    return animation;
-  }
-
-private:
-  // bool newVertex(const Vertex<T>& vertex);
-  // bool newEdge(const Vertex<T>& source, const Vertex<T>& target, int weight = 1);
-  // bool deleteVertex(const Vertex<T>& vertex);
-  // bool deleteEdge(const Vertex<T>& source, const Vertex<T>& target);
-  bool clearVertex(const Vertex<T>& vertex);
-  void resetVerticesFields();
-  void reconstructPath(Vertex<T>* current, Vertex<T>* source, 
-                       List<T>& path) const; // path most be empty
-  
-  void bfs(Vertex<T>* root, Graph& resulting_tree);
-  void dfs(Vertex<T>* root, Graph& resulting_tree);
-  void prim(Vertex<T>* root, Graph& min_expansion_tree);
-  void dijkstra(Vertex<T>* source);
-  int dijkstra(Vertex<T>* source, Vertex<T>* target, List<T>& path);
-
-  void bfs_animation(Vertex<T>* root, List<std::string>& animation);
-  void dfs_animation(Vertex<T>* root, List<std::string>& animation);
-  void dijkstra_animation(Vertex<T>* source, List<std::string>& animation);
-
-  typename List<Vertex<T>>::Iterator getIteratorOf(const T& vertex_id) const;
-  
-  bool weighted;
-  bool directed;
-  List<Vertex<T>> vertices; // Adjancecy list 
-  size_t degree = 0;
-};
-
-// ----------------- IMPLEMENTATION --------------------
-
-template <typename T>
-class Graph;
-
-template <typename T>
-Graph<T>::Graph(bool weighted, bool directed,
-                const std::initializer_list<T>& vertices_ids) {
-    degree = vertices_ids.size();
-    int i = 0;
-    for (const T& id : vertices_ids) {
-        vertices.append(Vertex<T>(id, i));
-        i++;
-    }
-    degree = vertices.getLength();
-    this->weighted = weighted;
-    this->directed = directed;
-}
-
-template <typename T>
-Graph<T>::Graph(const Graph<T>& other) : vertices(other.vertices) {
-    weighted = other.weighted;
-    directed = other.directed;
-    degree = other.degree;
-    //std::cout << "Graph copy constructor" << std::endl;
-}
-
-template <typename T>
-Graph<T>::Graph(Graph<T>&& other) : vertices(std::move(other.vertices)) {
-    weighted = other.weighted;
-    directed = other.directed;
-    degree = other.degree;
-    other.degree = 0;
-    //std::cout << "Graph move constructor" << std::endl;
-}
-
-template <typename T>
-Graph<T>& Graph<T>::operator=(const Graph& other) {
-    if (this != &other) {
-        vertices = other.vertices;
-        weighted = other.weighted;
-        directed = other.directed;
-        degree = other.degree;
-        //std::cout << "Graph copy assignation" << std::endl;
-    }
-    return *this;
-}
-
-template <typename T>
-Graph<T>& Graph<T>::operator=(Graph&& other) {
-    if (this != &other) {
-        vertices = std::move(other.vertices);
-        weighted = other.weighted;
-        directed = other.directed;
-        degree = other.degree;
-        other.degree = 0;
-        //std::cout << "Graph move assignation" << std::endl;
-    }
-    return *this;
-}
-
-template <typename T>
-bool Graph<T>::newVertex(const T& vertex_id) {
-    auto it = getIteratorOf(vertex_id);
-    if (it == end(vertices)) { // the vertex is added if it isn't inside the vector
-        vertices.append(Vertex<T>(vertex_id, degree));
-        degree++;
-        return true;
-    }
-    return false;
-}
-
-template <typename T>
-bool Graph<T>::deleteVertex(const T& vertex_id) {
-    auto vertex_it = getIteratorOf(vertex_id);
-    if (vertex_it != end(vertices)) {
-        int k = 0;
-        for (auto it = begin(vertices); it != end(vertices); it++, k++) {
-            it->neighbors.remove_one(NeighborVertex<T>(&(*vertex_it)));
-            it->index = k;
-            if (k == vertex_it->index) k--;
-        }
-        vertices.erase(vertex_it);
-        degree--;
-    }
-    return false;
-}
-
-template <typename T>
-bool Graph<T>::newEdge(const T& source_id, const T& target_id, int weight) {
-    auto source_it = getIteratorOf(source_id);
-    auto target_it = getIteratorOf(target_id);
-    if (source_it != end(vertices) and target_it != end(vertices)) {
-        source_it->neighbors.append(NeighborVertex<T>(&(*target_it), weight));
-        if (!directed) {
-            target_it->neighbors.append(NeighborVertex<T>(&(*source_it), weight));
-        }
-        return true;
-    }
-    return false;
-}
-
-template <typename T>
-bool Graph<T>::deleteEdge(const T& source_id, const T& target_id) {
-    auto s_it = vertices.getIteratorOf(source_id);
-    auto t_it = vertices.getIteratorOf(target_id);
-    if (s_it != end(vertices) and t_it != end(vertices)) {
-        s_it->neighbors.remove_one(NeighborVertex<T>(&(*t_it)));
-        if (!directed) {
-            t_it->neighbors.remove_one(NeighborVertex<T>(&(*s_it)));
-        }
-        return true;
-    }
-    return false;
-}
-
-template <typename T>
-bool Graph<T>::clearVertex(const Vertex<T>& vertex) {
-    auto it = vertices.getIteratorOf(vertex);
-    if (it != end(vertices)) {
-        it->neighbors.clear();
-        return true;
-    }
-    return false;
-}
-
-template <typename T>
-void Graph<T>::resetVerticesFields() {
-    for (Vertex<T>& vertex : vertices) {
-        vertex.visited = false;
-        vertex.distance = INT32_MAX;
-        vertex.parent = nullptr;
-    }
-}
-
-template <typename T>
-void Graph<T>::reconstructPath(Vertex<T>* current, Vertex<T>* source,
-                               List<T>& path) const {
-    while (current != source) {
-        path.push_first(current->id);
-        current = current->parent;
-    }
-    path.push_first(current->id);
-}
-
-template<class T>
-bool Graph<T>::readAdjacencyMatrix(const AdjacencyMatrix& adjacencyMatrix) {
-    int degree = adjacencyMatrix.size();
-    if (degree != this->degree) {
-        return false; // Degree of the matrix and degree of the graph most be equal
-    }
-    for (const std::vector<int>& row : adjacencyMatrix) {
-        if (row.size() != degree) {
-            return false; // The matrix is not squared
-        }
-    }
-    // At this point the matrix accomplish the requirements
-    int i = 0;
-    for (Vertex<T>& vertex: vertices) {
-        if (!vertex.neighbors.isEmpty()) {
-            vertex.neighbors.clear();
-        }
-        for (int j = 0; j < degree; j++) {
-            if (adjacencyMatrix[i][j] != 0) {
-                vertex.neighbors.append(
-                                         NeighborVertex<T>(&vertices[j], adjacencyMatrix[i][j])
-                                         );
-            }
-        }
-        i++;
-    }
-    return true;
-}
-
-template <class T>
-AdjacencyMatrix Graph<T>::obtainAdjacencyMatrix() {
-    AdjacencyMatrix adjacencyMatrix;
-    for (int i = 0; i < degree; i++) {
-        auto it = begin(vertices[i].neighbors);
-        if (it == end(vertices[i - 1].neighbors)) { // The vertex hasn't neighbors
-            adjacencyMatrix.push_back(std::vector<int>(degree, 0));
-        } else {
-            adjacencyMatrix.push_back(std::vector<int>());
-            for (int j = 0, index = it->vertex->index; j < degree; j++) {
-                if (j != index) {
-                    adjacencyMatrix[i].push_back(0);
-                } else {
-                    adjacencyMatrix[i].push_back(weighted ? it->weight : 1);
-                    it++;
-                    if (it != end(vertices[i].neighbors))  {
-                        index = it->vertex->index;
-                    }
-                }
-            }
-        }
-    }
-    return adjacencyMatrix;
-}
-
-template <class T>
-void Graph<T>::bfs(Vertex<T>* root, Graph& resulting_tree) {
-    List<Vertex<T>*> queue = {root};
-    root->visited = true;
-    while (!queue.isEmpty()) {
-        Vertex<T>* first = queue[0];
-        queue.pop_first();
-        for (NeighborVertex<T>& neighbour : first->neighbors) {
-            resulting_tree.newVertex(first->id);
-            if (!neighbour.vertex->visited) {
-                resulting_tree.newVertex(neighbour.vertex->id);
-                resulting_tree.newEdge(first->id, neighbour.vertex->id);
-                queue.append(neighbour.vertex);
-                neighbour.vertex->visited = true;
-            }
-        }
-    }
-    resetVerticesFields();
-}
-
-template <class T>
-void Graph<T>::dfs(Vertex<T>* root, Graph& resulting_tree) {
-    List<Vertex<T>*> stack = {root};
-    root->visited = true;
-    while (!stack.isEmpty()) {
-        Vertex<T>* first = stack[stack.getLength() - 1];
-        stack.pop();
-        for (NeighborVertex<T>& neighbour : first->neighbors) {
-            resulting_tree.newVertex(first->id);
-            if (!neighbour.vertex->visited) {
-                resulting_tree.newVertex(neighbour.vertex->id);
-                resulting_tree.newEdge(first->id, neighbour.vertex->id);
-                stack.append(neighbour.vertex);
-                neighbour.vertex->visited = true;
-            }
-        }
-    }
-    resetVerticesFields();
-}
-
-template <typename T>
-void Graph<T>::prim(Vertex<T>* root, Graph& min_expansion_tree) {
-    root->distance = 0;
-    MinHeap<Vertex<T>*> min_heap = {root};
-    while (not min_heap.isEmpty()) {
-        Vertex<T>* best = min_heap.getMin();
-        min_heap.pop();
-        best->visited = true;
-        for (NeighborVertex<T>& neighbour : best->neighbors) {
-            if (neighbour.weight < neighbour.vertex->distance and
-                not neighbour.vertex->visited) {
-                neighbour.vertex->distance = neighbour.weight;
-                neighbour.vertex->parent = best;
-                min_heap.push(neighbour.vertex);
-            }
-        }
-    }
-    for (const Vertex<T>& vertex : vertices) {
-        if (vertex.parent != nullptr and vertex.visited) {
-            min_expansion_tree.newVertex(vertex.id);
-            min_expansion_tree.newVertex(vertex.parent->id);
-            min_expansion_tree.newEdge(
-                                       vertex.parent->id, vertex.id, vertex.distance
-                                       );
-        }
-    }
-    resetVerticesFields();
-}
-
-template <typename T>
-void Graph<T>::dijkstra(Vertex<T>* source) {
-    source->distance = 0;
-    MinHeap<Vertex<T>*> min_heap = {source};
-    while (not min_heap.isEmpty()) {
-        const Vertex<T>* best = min_heap.getMin();
-        min_heap.pop();
-        for (NeighborVertex<T>& neighbour : best->neighbors) {
-            if (neighbour.weight + best->distance < neighbour.vertex->distance) {
-                neighbour.vertex->distance = neighbour.weight + best->distance;
-                min_heap.push(neighbour.vertex);
-            }
-        }
-    }
-}
-
-template <typename T>
-int Graph<T>::dijkstra(Vertex<T>* source, Vertex<T>* target, List<T>& path) {
-    source->distance = 0;
-    MinHeap<Vertex<T>*> min_heap = {source};
-    while (not min_heap.isEmpty()) {
-        Vertex<T>* best = min_heap.getMin();
-        min_heap.pop();
-        if (best == target) {
-            reconstructPath(best, source, path);
-            return best->distance;
-        }
-        for (NeighborVertex<T>& neighbour : best->neighbors) {
-            if (neighbour.weight + best->distance < neighbour.vertex->distance) {
-                neighbour.vertex->distance = neighbour.weight + best->distance;
-                neighbour.vertex->parent = best;
-                min_heap.push(neighbour.vertex);
-            }
-        }
-    }
-    return -1; // No path finded
-}
-
-template <typename T>
-void Graph<T>::bfs_animation(Vertex<T>* root, List<std::string>& animation) {
-    std::stringstream ss;
-    ss << "digraph {\n";
-    List<Vertex<T>*> queue = {root};
-    root->visited = true;
-    ss << "\t\"" << root->id << "\"\n";
-    animation.append(ss.str() += '}');
-    while (!queue.isEmpty()) {
-        Vertex<T>* first = queue[0];
-        queue.pop_first();
-        for (NeighborVertex<T>& neighbour : first->neighbors) {
-            if (!neighbour.vertex->visited) {
-                ss << "\t\"" << first->id << "\" -> \"" << neighbour.vertex->id << "\"\n";
-                queue.append(neighbour.vertex);
-                neighbour.vertex->visited = true;
-                animation.append(ss.str() += '}');
-            }
-        }
-    }
-    resetVerticesFields();
-}
-
-template <class T>
-void Graph<T>::dfs_animation(Vertex<T>* root, List<std::string>& animation) {
-    List<Vertex<T>*> stack = {root};
-    std::stringstream ss;
-    ss << "digraph {\n";
-    root->visited = true;
-    ss << "\t\"" << root->id << "\"\n";
-    animation.append(ss.str() += '}');
-    while (!stack.isEmpty()) {
-        Vertex<T>* first = stack[stack.getLength() - 1];
-        stack.pop();
-        for (NeighborVertex<T>& neighbour : first->neighbors) {
-            if (!neighbour.vertex->visited) {
-                ss << "\t\"" << first->id << "\" -> \"" << neighbour.vertex->id << "\"\n";
-                stack.append(neighbour.vertex);
-                neighbour.vertex->visited = true;
-                animation.append(ss.str() += '}');
-            }
-        }
-    }
-    resetVerticesFields();
-}
-
-template <typename T>
-void Graph<T>::dijkstra_animation(Vertex<T>* source,
-                                  List<std::string>& animation) {
-    source->distance = 0;
-    MinHeap<Vertex<T>*> min_heap = {source};
-    animation.append(dotRepr(GraphDrawingMode::SHOW_DISTANCES));
-    while (! min_heap.empty()) {
-        const Vertex<T>* best = min_heap.getMin();
-        min_heap.pop();
-        for (NeighborVertex<T>& neighbour : best->neighbors) {
-            if (neighbour.weight + best->distance < neighbour.vertex->distance) {
-                neighbour.vertex->distance = neighbour.weight + best->distance;
-                min_heap.push(neighbour.vertex);
-                animation.append(dotRepr(GraphDrawingMode::SHOW_DISTANCES));
-            }
-        }
-    }
-}
-
-template <typename T> typename List<Vertex<T>>::Iterator
-Graph<T>::getIteratorOf(const T& vertex_id) const {
-    for (auto it = begin(vertices); it != end(vertices); it++) {
-        if (it->id == vertex_id) {
-            return it;
-        }
-    }
-    return List<Vertex<T>>::NO_ELEMENT;
-}
-
-template <class T>
-std::string Graph<T>::dotRepr(GraphDrawingMode drawingMode) const {
-    if (degree == 0) return {};
-    
-    std::stringstream ss;
-    ss << (directed ? "digraph " : "strict graph ") << " {\n";
-    
-    for (const Vertex<T>& vertex : vertices) {
-        if (vertex.neighbors.isEmpty()) {
-            ss << "\t\"" << vertex.id << "\"" << std::endl;
-        } else {
-            for (const NeighborVertex<T>& neighbor : vertex.neighbors) {
-                // This switch it's so dirty.
-                switch (drawingMode) {
-                    case GraphDrawingMode::DEFAULT:
-                        ss << "\t\"" << vertex.id;
-                        ss << (directed ? "\" -> \"" : "\" -- \"") << neighbor.vertex->id << "\"  [";
-                        if (weighted) {
-                            ss << "taillabel = \"" << neighbor.weight << "\", ";
-                        }
-                        break;
-                    case GraphDrawingMode::SHOW_DISTANCES:
-                        ss << "\t\"" << vertex.id << " | ";
-                        if (vertex.distance == INT32_MAX) {
-                            ss << "inf";
-                        } else {
-                            ss << vertex.distance;
-                        }
-                        ss << (directed ? "\" -> \"" : "\" -- \"") << neighbor.vertex->id << " | ";
-                        if (neighbor.vertex->distance == INT32_MAX) {
-                            ss << "inf";
-                        } else {
-                            ss << neighbor.vertex->distance;
-                        }
-                        ss << "\" [";
-                        if (weighted) {
-                            ss << "taillabel = \"" << neighbor.weight << "\", ";
-                        }
-                        break;
-                }
-                ss << "labeldistance = 1.5]" << std::endl;
-            }
-        }
-    }
-    ss << "}";
-    return ss.str();
-}
-
-} // easy_graphs namespace end
-
-#endif // GRAPH_H
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#include <vector>
+#include <algorithm>
+#include <ostream>
+#include <sstream>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <tuple>
+#include <unordered_map>
+#include <atomic>
+
+#include "parallel.h"
+
+#include "vertex.h"
+#include "neighbor_vertex.h"
+#include "heap.h"
+#include "sparse_matrix.h"
+#include "animation.h"
+#include "algorithm_stats.h"
+#include "trace.h"
+#include "memory_usage.h"
+
+namespace easy_graphs {
+
+enum class GraphDrawingMode {
+    DEFAULT,
+    SHOW_DISTANCES
+};
+
+typedef std::vector<std::vector<int>> AdjacencyMatrix;
+
+// Weight of an edge given as a std::pair (always 1) or a std::tuple
+template <typename A, typename B>
+int edgeWeight(const std::pair<A, B>&) { return 1; }
+
+template <typename A, typename B, typename W>
+int edgeWeight(const std::tuple<A, B, W>& edge) { return int(std::get<2>(edge)); }
+
+template<class T>
+class JohnsonGraph;
+
+template<class T>
+class AdjacencySnapshot;
+
+template<class T>
+class GraphBuilder;
+
+template<class T>
+class BinaryGraphView;
+
+template<class T>
+class Graph {
+  friend class JohnsonGraph<T>;
+  friend class AdjacencySnapshot<T>;
+  friend class GraphBuilder<T>;
+  friend class BinaryGraphView<T>;
+ public:
+    // Constructors
+
+  /*
+    Copy constructor, the copy has its own vertices and edges
+    Complexity: Linear on the number of other.vertices plus 
+                the number of neighbors of each vertex in other.vertices
+   */
+  Graph(const Graph& other);
+  /*
+    Move constructor
+    Complexity : Constant - Yeah!
+   */
+  Graph(Graph&& other);
+  /*
+    Initializer constructor: Defines the characteristics of the graph
+    @param weighted Especifies if the graph is weighted
+    @param directed Especifies if the graph is directed
+    @param vertices_ids (optional) Initial vertices of the graph  
+   */
+	Graph(bool weighted, bool directed, 
+        const std::initializer_list<T>& vertices_ids = {});
+  /*
+    Copy assign
+    Complexity : Linear on the number of other.vertices plus 
+                 the number of neighbors of each vertex in other.vertices
+                 plus the cost of clean up the current adjacency matrix
+   */
+  Graph& operator=(const Graph& other);
+  /*
+    Move assign
+    Complexity : Cost of clean up the current adjacency matrix
+   */
+  Graph& operator=(Graph&& other);
+  
+  // Methods for modifying the graph:
+
+  bool newVertex(const T& vertex_id);
+  /*
+    Deletes a vertex and every edge from or to it
+    Complexity : Cost of a linear seach through the vertices plus
+                 the number of incident edges with the reverse index,
+                 the number of edges of the graph without it or when an
+                 undirected graph read from an asymmetric matrix has
+                 entries without mirror
+   */
+  bool deleteVertex(const T& vertex_id);
+  /*
+    Adds an edge, with the neighbour sets it returns false without adding
+    it if the edge is already in the graph
+   */
+  bool newEdge(const T& source_id, const T& target_id, int weight = 1);
+  /*
+    Deletes an edge
+    Complexity : Cost of a linear seach through the vertices plus
+                 O(d) with or without the neighbour sets: they find the
+                 edge in O(log d) but erasing it shifts their sorted
+                 array (O(1) expected for hubs, see NeighborIndex)
+   */
+  bool deleteEdge(const T& source_id, const T& target_id);
+  /*
+    Adds a range of edges, std::pair<T, T> or std::tuple<T, T, int>, with
+    one search of the vertices for the whole range instead of two searches
+    per edge. Edges with unknown ids (or rejected by the neighbour sets)
+    are skipped. T must be usable as a key of std::unordered_map.
+    Returns the number of edges added.
+    Complexity: O(V + number of edges), see GraphBuilder for bigger loads
+   */
+  template <typename Range>
+  size_t newEdges(const Range& edges);
+  /*
+    Checks if there is an edge from source to target
+    Complexity : Cost of a linear seach through the vertices plus
+                 O(log d) with the neighbour sets (O(1) expected for
+                 hubs), O(d) without them
+   */
+  bool hasEdge(const T& source_id, const T& target_id) const;
+
+  /*
+    Deletes all the edges from the given vertex, the undirected ones from
+    both endpoints
+    Complexity : Cost of a linear seach through the vertices plus
+                 the number of neighbors to destroy, plus O(d) for the
+                 mirror entry of each one in undirected graphs, as in
+                 deleteEdge
+   */
+  bool clearVertex(const T& vertex_id) {
+    return clearVertex(Vertex<T>(vertex_id));
+  }
+
+  /*
+    Deletes every vertex in the graph
+    All vertex has its own list of neighbors which are destroied also
+   */
+  void clearAll() {
+    vertices.clear();
+    degree = 0;
+  }
+
+  bool isWeighted() const { return weighted; }
+
+  bool isDirected() const { return directed; }
+
+  // Number of vertices
+  size_t getDegree() const { return degree; }
+
+  /*
+    Bytes held by the graph, split in the vertices, their adjacency lists,
+    the neighbour sets and the ids (std::string ids with the characters
+    they allocate, see DynamicMemory for other types), plus an estimate of
+    what the allocator spends on every block (see allocationOverhead).
+    Complexity: O(V)
+   */
+  MemoryUsage memoryUsage() const;
+
+  /*
+    Reverse index: every edge is also kept in the list of in-edges of its
+    target (directed graphs) and the two entries of an edge point to each
+    other, so deleting a vertex or enumerating its predecessors only touches
+    its incident edges. It costs one more list entry per directed edge plus
+    one pointer per entry, and it is kept up to date until it is disabled.
+    Complexity: O(V + E) to build
+   */
+  void enableReverseIndex() {
+    reverse_index = true;
+    buildReverseIndex();
+  }
+
+  void disableReverseIndex() {
+    reverse_index = false;
+    for (Vertex<T>& vertex : vertices) {
+      vertex.predecessors.clear();
+      for (NeighborVertex<T>& neighbour : vertex.neighbors) {
+        neighbour.twin = nullptr;
+      }
+    }
+  }
+
+  bool hasReverseIndex() const { return reverse_index; }
+
+  /*
+    Neighbour sets: every vertex also keeps its out-neighbours sorted in a
+    contiguous array (a hash table for hubs, see NeighborIndex), which makes
+    hasEdge logarithmic on the degree and lets newEdge reject parallel
+    edges. deleteEdge finds the edge as fast, but erasing it from the
+    array is an O(d) shift. Enabling them drops the parallel edges already
+    in the graph, keeping the first one of each pair of vertices.
+    Complexity: O(E log d) to build
+   */
+  void enableNeighborSets();
+
+  void disableNeighborSets() {
+    neighbor_sets = false;
+    for (Vertex<T>& vertex : vertices) {
+      vertex.neighbor_set.clear();
+    }
+  }
+
+  bool hasNeighborSets() const { return neighbor_sets; }
+
+  /*
+    Ids of the sources of the edges which arrive to the given vertex
+    Complexity: The in-degree of the vertex with the reverse index,
+                the number of edges of the graph without it (or with
+                entries without mirror, see deleteVertex)
+   */
+  List<T> getPredecessors(const T& vertex_id) const;
+
+  /* 
+    Method to read an adjacency matrix wich has to have the same rank as
+    the degree of the graph
+    Complexity: O(V^2)
+   */
+  bool readAdjacencyMatrix(const AdjacencyMatrix& adjacencyMatrix);
+
+  /*
+    Method to obtain the adjacancy matrix of the current graph
+    The order in which appear the elements of the matrix, is the order
+    in which are the element in the adjacency list
+    Complexity: O(V^2)
+   */
+  AdjacencyMatrix obtainAdjacencyMatrix() const;
+
+  /*
+    Replaces the edges of the graph by the entries of a sparse matrix of
+    rank the degree of the graph, rows and columns numbered in insertion
+    order like readAdjacencyMatrix. Every stored entry is an edge, zeros
+    included, and repeated entries are parallel edges. Undirected graphs
+    expect both entries of every edge, as in a symmetric matrix.
+    False, leaving the graph untouched, if the matrix does not fit.
+    Complexity: O(V + E)
+   */
+  bool readSparseMatrix(const CsrMatrix& matrix);
+  bool readSparseMatrix(const CooMatrix& matrix);
+
+  /*
+    Sparse adjacency matrix with the neighbours of every row in the order
+    of the adjacency list, weights as values (1 in unweighted graphs).
+    toTriplets(obtainCooMatrix()) gives the triplets for Eigen.
+    Complexity: O(V + E)
+   */
+  CsrMatrix obtainCsrMatrix() const;
+  CooMatrix obtainCooMatrix() const;
+
+  /*
+    Subgraph induced by some of the vertices: keep[i] tells if the i-th
+    vertex in insertion order stays (the numbering of AdjacencySnapshot).
+    Vertices keep their relative order.
+    Complexity: O(V + E)
+   */
+  Graph inducedSubgraph(const std::vector<bool>& keep) const;
+
+  /*
+    Writes the dot description of the graph edge by edge to out, a
+    std::ostream or any sink with the same operator<< (e.g. the
+    BufferedWriter of io/buffered_writer.h, which writes to a file with
+    a fixed size buffer). Nothing is written for an empty graph.
+    Complexity: O(V + E), without memory proportional to the output
+   */
+  template <typename Sink>
+  void writeDot(Sink& out, GraphDrawingMode drawing_mode =
+                GraphDrawingMode::DEFAULT) const;
+
+  // Useful method to obtaing the dot description of the graph 
+  std::string dotRepr(GraphDrawingMode drawing_mode = 
+          GraphDrawingMode::DEFAULT) const;
+
+  // The returned string contains all vertices followed by their neighbors
+  std::string str() const {
+    std::ostringstream ss;
+    for (const Vertex<T>& vertex : vertices) {
+        ss << vertex.str() << std::endl;
+    }
+    return ss.str();
+  }
+  
+  /*
+    The traversals, dijkstra, prim and their animations take an optional
+    AlgorithmStats to which they add the counters of the run (vertices
+    visited, edges scanned, heap operations, ...), see algorithm_stats.h.
+   */
+  Graph bfs(const T& root_id, AlgorithmStats* stats = nullptr) {
+    Graph resulting_tree(false, true);
+    auto it = getIteratorOf(root_id);
+    if (it != end(vertices)) {
+      bfs(&(*it), resulting_tree, stats);
+    }
+    return resulting_tree;
+  }
+
+  Graph dfs(const T& root_id, AlgorithmStats* stats = nullptr) {
+    Graph resulting_tree(false, true);
+    auto it = getIteratorOf(root_id);
+    if (it != end(vertices)) {
+      dfs(&(*it), resulting_tree, stats);
+    }
+    return resulting_tree;
+  }
+
+  Graph prim(const T& root_id, AlgorithmStats* stats = nullptr) {
+    Graph min_expansion_tree(true, true);
+    auto it = getIteratorOf(root_id);
+    if (it != end(vertices)) {
+      prim(&(*it), min_expansion_tree, stats);
+    }
+    return min_expansion_tree;
+  }
+
+  void dijkstra(const T& source_id, AlgorithmStats* stats = nullptr) {
+    auto it = getIteratorOf(source_id);
+    if (it != end(vertices)) {
+      resetVerticesFields();
+      dijkstra(&(*it), stats);
+    }
+  }
+
+  List<T> dijkstra(const T& source_id, const T& target_id, int& distance,
+                   AlgorithmStats* stats = nullptr) {
+    auto s_it = getIteratorOf(source_id);
+    auto t_it = getIteratorOf(target_id);
+    if (s_it != end(vertices) and t_it != end(vertices)) {
+      resetVerticesFields();
+      List<T> path;
+      distance = dijkstra(&(*s_it), &(*t_it), path, stats);
+      return path;
+    }
+    distance = -2; // source_id or target_id do not exist
+    return {};
+  }
+
+  /*
+    Single source shortest paths which allows negative weights, using the
+    queue based Bellman-Ford (SPFA). As dijkstra(source_id), it leaves the
+    distance and the parent of each vertex in the graph.
+    Returns false if source_id does not exist or if a negative cycle is
+    reachable from it, in that case the distances are meaningless.
+    Complexity: O(V * E) in the worst case, close to O(E) in practice
+   */
+  bool bellmanFord(const T& source_id) {
+    auto it = getIteratorOf(source_id);
+    if (it != end(vertices)) {
+      resetVerticesFields();
+      return bellmanFord(&(*it));
+    }
+    return false;
+  }
+
+  /*
+    Shortest path from source_id to target_id allowing negative weights.
+    If there is no path, some of the vertices does not exist or a negative
+    cycle is reachable from source_id, the path is empty and distance is
+    INT32_MAX (negative distances are valid results here).
+   */
+  List<T> bellmanFord(const T& source_id, const T& target_id, int& distance) {
+    auto s_it = getIteratorOf(source_id);
+    auto t_it = getIteratorOf(target_id);
+    List<T> path;
+    distance = INT32_MAX;
+    if (s_it != end(vertices) and t_it != end(vertices)) {
+      resetVerticesFields();
+      if (bellmanFord(&(*s_it)) and t_it->distance != INT32_MAX) {
+        distance = t_it->distance;
+        reconstructPath(&(*t_it), &(*s_it), path);
+      }
+    }
+    return path;
+  }
+
+  /*
+    Round based Bellman-Ford for large graphs: every round relaxes the
+    out-edges of the vertices improved in the previous round, with the
+    frontier split between num_threads threads (0 = hardware concurrency).
+    Same results and return value as bellmanFord(source_id).
+    Complexity: O(V * E) work in the worst case, O(V + E) per round
+   */
+  bool parallelBellmanFord(const T& source_id, unsigned num_threads = 0) {
+    auto it = getIteratorOf(source_id);
+    if (it != end(vertices)) {
+      resetVerticesFields();
+      return parallelBellmanFord(&(*it), num_threads);
+    }
+    return false;
+  }
+
+  List<std::string> bfs_animation(const T& root_id, AlgorithmStats* stats = nullptr) {
+    List<std::string> animation;
+    auto it = getIteratorOf(root_id);
+    if (it != end(vertices)) {
+      bfs_animation(&(*it), animation, stats);
+    }
+    return animation;
+  }
+
+  List<std::string> dfs_animation(const T& root_id, AlgorithmStats* stats = nullptr) {
+    List<std::string> animation;
+    auto it = getIteratorOf(root_id);
+    if (it != end(vertices)) {
+      dfs_animation(&(*it), animation, stats);
+    }
+    return animation;
+  }
+
+  /*
+    Frames of the animations of bfs and dfs without building their strings
+    (see AnimationFrames): each frame, or only what it adds to the previous
+    one, is written when it is asked for. Empty if the root does not exist.
+    Complexity: O(V + E), O(V) memory
+   */
+  AnimationFrames<T> bfs_frames(const T& root_id, AlgorithmStats* stats = nullptr) {
+    AnimationFrames<T> frames;
+    auto it = getIteratorOf(root_id);
+    if (it != end(vertices)) {
+      traversalFrames(&(*it), true, frames, stats);
+    }
+    return frames;
+  }
+
+  AnimationFrames<T> dfs_frames(const T& root_id, AlgorithmStats* stats = nullptr) {
+    AnimationFrames<T> frames;
+    auto it = getIteratorOf(root_id);
+    if (it != end(vertices)) {
+      traversalFrames(&(*it), false, frames, stats);
+    }
+    return frames;
+  }
+
+  /*
+    Runs dijkstra(source_id) and records its relaxations and settled
+    vertices (see DijkstraTrace), from which the frames of
+    dijkstra_animation are drawn when they are asked for.
+    Empty if source_id does not exist.
+    Complexity: O((V + E) log V) plus O(V + E) for the copy of the edges
+   */
+  DijkstraTrace<T> dijkstra_trace(const T& source_id, AlgorithmStats* stats = nullptr) {
+    DijkstraTrace<T> trace;
+    auto it = getIteratorOf(source_id);
+    if (it != end(vertices)) {
+      resetVerticesFields();
+      dijkstraTrace(&(*it), trace, stats);
+    }
+    return trace;
+  }
+
+  List<std::string> dijkstra_animation(const T& source_id, AlgorithmStats* stats = nullptr) {
+    List<std::string> animation;
+    auto it = getIteratorOf(source_id);
+    if (it != end(vertices)) {
+      resetVerticesFields();
+      dijkstra_animation(&(*it), animation, stats);
+    }
+    return animation;
+  }
+
+private:
+  // bool newVertex(const Vertex<T>& vertex);
+  // bool newEdge(const Vertex<T>& source, const Vertex<T>& target, int weight = 1);
+  // bool deleteVertex(const Vertex<T>& vertex);
+  // bool deleteEdge(const Vertex<T>& source, const Vertex<T>& target);
+  // Entries of the heaps: the key when it was pushed and the vertex, so
+  // the order is not broken when the key of the vertex decreases later
+  typedef std::pair<int, Vertex<T>*> HeapEntry;
+
+  bool clearVertex(const Vertex<T>& vertex);
+  // Appends the edge (and its reverse entry) to the adjacency lists
+  void linkEdge(Vertex<T>* source, Vertex<T>* target, int weight);
+  // Erases an out-edge of source and, with the reverse index, its twin
+  void unlinkEdge(Vertex<T>* source,
+                  typename List<NeighborVertex<T>>::Iterator entry);
+  void buildReverseIndex();
+  template <typename Sink>
+  static void writeDistance(Sink& out, int distance) {
+    if (distance == INT32_MAX) {
+      out << "inf";
+    } else {
+      out << distance;
+    }
+  }
+  // Graph whose row i, of a compressed sparse rows adjacency, holds the
+  // neighbours of ids[i]; every edge of undirected graphs is in both rows
+  static Graph fromRows(bool weighted, bool directed, const std::vector<T>& ids,
+                        const std::vector<size_t>& offsets,
+                        const std::vector<uint32_t>& columns,
+                        const std::vector<int>& weights);
+  // Entry of the edge source -> target, NO_ELEMENT if there is none
+  typename List<NeighborVertex<T>>::Iterator findEdge(Vertex<T>* source,
+                                                      const Vertex<T>* target) const;
+  void resetVerticesFields();
+  void reconstructPath(Vertex<T>* current, Vertex<T>* source, 
+                       List<T>& path) const; // path most be empty
+  
+  void bfs(Vertex<T>* root, Graph& resulting_tree, AlgorithmStats* stats);
+  void dfs(Vertex<T>* root, Graph& resulting_tree, AlgorithmStats* stats);
+  void prim(Vertex<T>* root, Graph& min_expansion_tree, AlgorithmStats* stats);
+  void dijkstra(Vertex<T>* source, AlgorithmStats* stats);
+  int dijkstra(Vertex<T>* source, Vertex<T>* target, List<T>& path,
+               AlgorithmStats* stats);
+  bool bellmanFord(Vertex<T>* source);
+  bool bellmanFord(List<Vertex<T>*>& queue); // queue holds the sources
+  bool parallelBellmanFord(Vertex<T>* source, unsigned num_threads);
+
+  void bfs_animation(Vertex<T>* root, List<std::string>& animation,
+                     AlgorithmStats* stats);
+  void dfs_animation(Vertex<T>* root, List<std::string>& animation,
+                     AlgorithmStats* stats);
+  // Tree edges of bfs (breadth) or dfs in discovery order
+  void traversalFrames(Vertex<T>* root, bool breadth, AnimationFrames<T>& frames,
+                       AlgorithmStats* stats);
+  void dijkstra_animation(Vertex<T>* source, List<std::string>& animation,
+                          AlgorithmStats* stats);
+  void dijkstraTrace(Vertex<T>* source, DijkstraTrace<T>& trace, AlgorithmStats* stats);
+
+  typename List<Vertex<T>>::Iterator getIteratorOf(const T& vertex_id) const;
+  // Vertices indexed by their index field
+  std::vector<Vertex<T>*> vertexTable() const;
+  // Index of the vertex with the given id or -1 if it does not exist
+  long indexOf(const T& vertex_id) const;
+  /*
+    Copy of the graph where the edge i -> j with weight w gets the weight
+    reweight(i, j, w), i and j are vertex indices. Complexity: O(V + E)
+   */
+  template <typename Reweight>
+  Graph reweightedCopy(Reweight reweight) const;
+  /*
+    Compressed sparse rows of the adjacency list: the neighbours of the
+    vertex with index i are targets[offsets[i]] .. targets[offsets[i + 1] - 1].
+    With transposed the rows hold the in-neighbours instead.
+    weights is left empty for unweighted graphs. Complexity: O(V + E)
+   */
+  void compressedRows(std::vector<size_t>& offsets, std::vector<uint32_t>& targets,
+                      std::vector<int>& weights, bool transposed) const;
+  
+  bool weighted;
+  bool directed;
+  List<Vertex<T>> vertices; // Adjancecy list 
+  size_t degree = 0;
+  bool reverse_index = false;
+  bool unpaired_entries = false; // undirected entries whose mirror is missing
+  bool neighbor_sets = false;
+};
+
+// ----------------- IMPLEMENTATION --------------------
+
+template <typename T>
+class Graph;
+
+template <typename T>
+Graph<T>::Graph(bool weighted, bool directed,
+                const std::initializer_list<T>& vertices_ids) {
+    EASY_GRAPHS_TRACE("Graph::Graph");
+    degree = vertices_ids.size();
+    int i = 0;
+    for (const T& id : vertices_ids) {
+        vertices.append(Vertex<T>(id, i));
+        i++;
+    }
+    degree = vertices.getLength();
+    this->weighted = weighted;
+    this->directed = directed;
+}
+
+template <typename T>
+Graph<T>::Graph(const Graph<T>& other)
+    : Graph(other.reweightedCopy([](size_t, size_t, int weight) { return weight; })) {
+    //std::cout << "Graph copy constructor" << std::endl;
+}
+
+template <typename T>
+Graph<T>::Graph(Graph<T>&& other) : vertices(std::move(other.vertices)) {
+    weighted = other.weighted;
+    directed = other.directed;
+    degree = other.degree;
+    reverse_index = other.reverse_index;
+    unpaired_entries = other.unpaired_entries;
+    neighbor_sets = other.neighbor_sets;
+    other.degree = 0;
+    //std::cout << "Graph move constructor" << std::endl;
+}
+
+template <typename T>
+Graph<T>& Graph<T>::operator=(const Graph& other) {
+    if (this != &other) {
+        *this = other.reweightedCopy([](size_t, size_t, int weight) { return weight; });
+        //std::cout << "Graph copy assignation" << std::endl;
+    }
+    return *this;
+}
+
+template <typename T>
+Graph<T>& Graph<T>::operator=(Graph&& other) {
+    if (this != &other) {
+        vertices = std::move(other.vertices);
+        weighted = other.weighted;
+        directed = other.directed;
+        degree = other.degree;
+        reverse_index = other.reverse_index;
+        unpaired_entries = other.unpaired_entries;
+        neighbor_sets = other.neighbor_sets;
+        other.degree = 0;
+        //std::cout << "Graph move assignation" << std::endl;
+    }
+    return *this;
+}
+
+template <typename T>
+bool Graph<T>::newVertex(const T& vertex_id) {
+    auto it = getIteratorOf(vertex_id);
+    if (it == end(vertices)) { // the vertex is added if it isn't inside the vector
+        vertices.append(Vertex<T>(vertex_id, degree));
+        degree++;
+        return true;
+    }
+    return false;
+}
+
+template <typename T>
+bool Graph<T>::deleteVertex(const T& vertex_id) {
+    auto vertex_it = getIteratorOf(vertex_id);
+    if (vertex_it == end(vertices)) {
+        return false;
+    }
+    Vertex<T>* vertex = &(*vertex_it);
+    // An entry towards the vertex whose mirror is missing (e.g. read from
+    // an asymmetric matrix) is not reachable from the vertex, then every
+    // list is searched as without the index
+    bool incident_only = reverse_index and (directed or not unpaired_entries);
+    if (neighbor_sets) {
+        // The sets of the vertices with edges towards the deleted one
+        if (incident_only) {
+            for (NeighborVertex<T>& entry : directed ? vertex->predecessors : vertex->neighbors) {
+                entry.vertex->neighbor_set.erase(vertex);
+            }
+        } else {
+            for (Vertex<T>& other : vertices) {
+                other.neighbor_set.erase(vertex);
+            }
+        }
+    }
+    if (incident_only) {
+        // Only the entries of the incident edges are touched, the lists of
+        // the vertex itself are destroyed with it
+        for (NeighborVertex<T>& neighbour : vertex->neighbors) {
+            if (neighbour.vertex != vertex and
+                neighbour.twin != List<NeighborVertex<T>>::NO_ELEMENT) {
+                List<NeighborVertex<T>>& other = directed ?
+                    neighbour.vertex->predecessors : neighbour.vertex->neighbors;
+                other.erase(neighbour.twin);
+            }
+        }
+        for (NeighborVertex<T>& predecessor : vertex->predecessors) {
+            if (predecessor.vertex != vertex) { // always paired
+                predecessor.vertex->neighbors.erase(predecessor.twin);
+            }
+        }
+    } else {
+        for (Vertex<T>& other : vertices) {
+            other.neighbors.remove(NeighborVertex<T>(vertex));
+        }
+    }
+    // The following vertices move one place back
+    auto it = vertex_it;
+    for (it++; it != end(vertices); it++) {
+        it->index--;
+    }
+    vertices.erase(vertex_it);
+    degree--;
+    return true;
+}
+
+template <typename T>
+bool Graph<T>::newEdge(const T& source_id, const T& target_id, int weight) {
+    auto source_it = getIteratorOf(source_id);
+    auto target_it = getIteratorOf(target_id);
+    if (source_it != end(vertices) and target_it != end(vertices)) {
+        if (neighbor_sets and
+            source_it->neighbor_set.find(&(*target_it)) != List<NeighborVertex<T>>::NO_ELEMENT) {
+            return false;
+        }
+        linkEdge(&(*source_it), &(*target_it), weight);
+        return true;
+    }
+    return false;
+}
+
+template <typename T>
+template <typename Range>
+size_t Graph<T>::newEdges(const Range& edges) {
+    std::unordered_map<T, Vertex<T>*> table;
+    table.reserve(degree);
+    for (Vertex<T>& vertex : vertices) {
+        table.insert(std::make_pair(vertex.id, &vertex));
+    }
+    size_t added = 0;
+    for (const auto& edge : edges) {
+        auto source = table.find(std::get<0>(edge));
+        auto target = table.find(std::get<1>(edge));
+        if (source == table.end() or target == table.end()) continue;
+        if (neighbor_sets and source->second->neighbor_set.find(target->second)
+                              != List<NeighborVertex<T>>::NO_ELEMENT) {
+            continue;
+        }
+        linkEdge(source->second, target->second, edgeWeight(edge));
+        added++;
+    }
+    return added;
+}
+
+template <typename T>
+Graph<T> Graph<T>::fromRows(bool weighted, bool directed, const std::vector<T>& ids,
+                            const std::vector<size_t>& offsets,
+                            const std::vector<uint32_t>& columns,
+                            const std::vector<int>& weights) {
+    EASY_GRAPHS_TRACE("Graph::fromRows");
+    Graph graph(weighted, directed);
+    for (size_t i = 0; i < ids.size(); i++) {
+        graph.vertices.append(Vertex<T>(ids[i], i));
+    }
+    graph.degree = ids.size();
+    std::vector<Vertex<T>*> table = graph.vertexTable();
+    for (size_t i = 0; i < ids.size(); i++) {
+        List<NeighborVertex<T>>& neighbors = table[i]->neighbors;
+        for (size_t e = offsets[i]; e < offsets[i + 1]; e++) {
+            neighbors.append(NeighborVertex<T>(table[columns[e]],
+                                               weights.empty() ? 1 : weights[e]));
+        }
+    }
+    return graph;
+}
+
+template <typename T>
+bool Graph<T>::deleteEdge(const T& source_id, const T& target_id) {
+    auto s_it = getIteratorOf(source_id);
+    auto t_it = getIteratorOf(target_id);
+    if (s_it != end(vertices) and t_it != end(vertices)) {
+        if (reverse_index or neighbor_sets) {
+            auto entry = findEdge(&(*s_it), &(*t_it));
+            if (entry != List<NeighborVertex<T>>::NO_ELEMENT) {
+                unlinkEdge(&(*s_it), entry);
+            } else if (!directed) {
+                // An edge read only in the row of the target
+                entry = findEdge(&(*t_it), &(*s_it));
+                if (entry != List<NeighborVertex<T>>::NO_ELEMENT) {
+                    unlinkEdge(&(*t_it), entry);
+                }
+            }
+        } else {
+            s_it->neighbors.remove_one(NeighborVertex<T>(&(*t_it)));
+            if (!directed) {
+                t_it->neighbors.remove_one(NeighborVertex<T>(&(*s_it)));
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+template <typename T>
+bool Graph<T>::clearVertex(const Vertex<T>& vertex) {
+    auto it = getIteratorOf(vertex.id);
+    if (it != end(vertices)) {
+        // The mirror entries of undirected edges and the reverse entries
+        // of the index go too
+        while (not it->neighbors.isEmpty()) {
+            unlinkEdge(&(*it), begin(it->neighbors));
+        }
+        return true;
+    }
+    return false;
+}
+
+template <typename T>
+List<T> Graph<T>::getPredecessors(const T& vertex_id) const {
+    List<T> predecessors;
+    auto it = getIteratorOf(vertex_id);
+    if (it == end(vertices)) {
+        return predecessors;
+    }
+    // Entries without mirror are searched as in deleteVertex
+    if (reverse_index and (directed or not unpaired_entries)) {
+        for (const NeighborVertex<T>& entry :
+             directed ? it->predecessors : it->neighbors) {
+            predecessors.append(entry.vertex->id);
+        }
+    } else {
+        for (const Vertex<T>& vertex : vertices) {
+            for (const NeighborVertex<T>& neighbour : vertex.neighbors) {
+                if (neighbour.vertex == &(*it)) {
+                    predecessors.append(vertex.id);
+                }
+            }
+        }
+    }
+    return predecessors;
+}
+
+template <typename T>
+bool Graph<T>::hasEdge(const T& source_id, const T& target_id) const {
+    auto s_it = getIteratorOf(source_id);
+    auto t_it = getIteratorOf(target_id);
+    if (s_it == end(vertices) or t_it == end(vertices)) {
+        return false;
+    }
+    return findEdge(&(*s_it), &(*t_it)) != List<NeighborVertex<T>>::NO_ELEMENT;
+}
+
+template <typename T>
+typename List<NeighborVertex<T>>::Iterator Graph<T>::findEdge(Vertex<T>* source,
+                                                              const Vertex<T>* target) const {
+    if (neighbor_sets) {
+        return source->neighbor_set.find(target);
+    }
+    for (auto it = begin(source->neighbors); it != end(source->neighbors); it++) {
+        if (it->vertex == target) {
+            return it;
+        }
+    }
+    return List<NeighborVertex<T>>::NO_ELEMENT;
+}
+
+template <typename T>
+void Graph<T>::enableNeighborSets() {
+    neighbor_sets = true;
+    bool dropped = false;
+    for (Vertex<T>& vertex : vertices) {
+        vertex.neighbor_set.clear();
+        bool loop_pending = false; // second entry of an undirected self loop
+        for (auto it = begin(vertex.neighbors); it != end(vertex.neighbors); ) {
+            if (vertex.neighbor_set.insert(it->vertex, it)) {
+                loop_pending = not directed and it->vertex == &vertex;
+                it++;
+            } else if (loop_pending and it->vertex == &vertex) {
+                loop_pending = false;
+                it++;
+            } else {
+                it = vertex.neighbors.erase(it);
+                dropped = true;
+            }
+        }
+    }
+    if (dropped and reverse_index) {
+        buildReverseIndex();
+    }
+}
+
+template <typename T>
+void Graph<T>::linkEdge(Vertex<T>* source, Vertex<T>* target, int weight) {
+    source->neighbors.append(NeighborVertex<T>(target, weight));
+    auto forward = rbegin(source->neighbors);
+    if (neighbor_sets) {
+        source->neighbor_set.insert(target, forward);
+    }
+    if (directed) {
+        if (reverse_index) {
+            target->predecessors.append(NeighborVertex<T>(source, weight));
+            auto backward = rbegin(target->predecessors);
+            forward->twin = backward;
+            backward->twin = forward;
+        }
+    } else {
+        target->neighbors.append(NeighborVertex<T>(source, weight));
+        if (neighbor_sets) {
+            target->neighbor_set.insert(source, rbegin(target->neighbors));
+        }
+        if (reverse_index) {
+            auto backward = rbegin(target->neighbors);
+            forward->twin = backward;
+            backward->twin = forward;
+        }
+    }
+}
+
+template <typename T>
+void Graph<T>::unlinkEdge(Vertex<T>* source,
+                          typename List<NeighborVertex<T>>::Iterator entry) {
+    Vertex<T>* target = entry->vertex;
+    auto twin = entry->twin;
+    if (neighbor_sets) {
+        source->neighbor_set.erase(target);
+    }
+    source->neighbors.erase(entry);
+    if (directed) {
+        if (reverse_index and twin != List<NeighborVertex<T>>::NO_ELEMENT) {
+            target->predecessors.erase(twin);
+        }
+        return;
+    }
+    // The first entry towards source goes, as without the index. When it
+    // is not the twin (parallel edges, or mirror entries missing from an
+    // asymmetric matrix) the twin takes its place in its pair.
+    auto mirror = twin;
+    if (neighbor_sets and target != source) {
+        mirror = target->neighbor_set.find(source);
+        target->neighbor_set.erase(source);
+    } else {
+        mirror = begin(target->neighbors);
+        while (mirror != end(target->neighbors) and mirror->vertex != source) {
+            mirror++;
+        }
+    }
+    if (mirror == List<NeighborVertex<T>>::NO_ELEMENT) {
+        return;
+    }
+    if (reverse_index and mirror != twin) {
+        auto partner = mirror->twin;
+        if (twin != List<NeighborVertex<T>>::NO_ELEMENT) {
+            twin->twin = partner;
+        }
+        if (partner != List<NeighborVertex<T>>::NO_ELEMENT) {
+            partner->twin = twin;
+        }
+        if (twin == List<NeighborVertex<T>>::NO_ELEMENT or
+            partner == List<NeighborVertex<T>>::NO_ELEMENT) {
+            unpaired_entries = true;
+        }
+    }
+    target->neighbors.erase(mirror);
+}
+
+template <typename T>
+void Graph<T>::buildReverseIndex() {
+    typedef typename List<NeighborVertex<T>>::Iterator Entry;
+    for (Vertex<T>& vertex : vertices) {
+        vertex.predecessors.clear();
+        for (NeighborVertex<T>& neighbour : vertex.neighbors) {
+            neighbour.twin = nullptr;
+        }
+    }
+    if (directed) {
+        for (Vertex<T>& vertex : vertices) {
+            for (auto it = begin(vertex.neighbors); it != end(vertex.neighbors); it++) {
+                Vertex<T>* target = it->vertex;
+                target->predecessors.append(NeighborVertex<T>(&vertex, it->weight));
+                auto backward = rbegin(target->predecessors);
+                it->twin = backward;
+                backward->twin = it;
+            }
+        }
+        return;
+    }
+    // Undirected graphs: every entry u -> v with u before v waits in the
+    // bucket of v, in order of u, until v pairs it with its own entries
+    // towards u, sorted the same way. Self loops are stored twice in a row.
+    std::vector<std::vector<std::pair<size_t, Entry>>> waiting(degree);
+    std::vector<std::pair<size_t, Entry>> own;
+    for (Vertex<T>& vertex : vertices) {
+        own.clear();
+        Entry loop = nullptr;
+        for (auto it = begin(vertex.neighbors); it != end(vertex.neighbors); it++) {
+            size_t other = it->vertex->index;
+            if (other > vertex.index) {
+                waiting[other].push_back(std::make_pair(vertex.index, it));
+            } else if (other < vertex.index) {
+                own.push_back(std::make_pair(other, it));
+            } else if (loop == List<NeighborVertex<T>>::NO_ELEMENT) {
+                loop = it;
+            } else {
+                loop->twin = it;
+                it->twin = loop;
+                loop = nullptr;
+            }
+        }
+        std::stable_sort(own.begin(), own.end(),
+            [](const std::pair<size_t, Entry>& a, const std::pair<size_t, Entry>& b) {
+                return a.first < b.first;
+            });
+        std::vector<std::pair<size_t, Entry>>& arrived = waiting[vertex.index];
+        for (size_t a = 0, b = 0; a < arrived.size() and b < own.size(); ) {
+            if (arrived[a].first < own[b].first) {
+                a++;
+            } else if (own[b].first < arrived[a].first) {
+                b++;
+            } else {
+                arrived[a].second->twin = own[b].second;
+                own[b].second->twin = arrived[a].second;
+                a++;
+                b++;
+            }
+        }
+        std::vector<std::pair<size_t, Entry>>().swap(arrived);
+    }
+    unpaired_entries = false;
+    for (Vertex<T>& vertex : vertices) {
+        for (NeighborVertex<T>& neighbour : vertex.neighbors) {
+            if (neighbour.twin == List<NeighborVertex<T>>::NO_ELEMENT) {
+                unpaired_entries = true;
+            }
+        }
+    }
+}
+
+template <typename T>
+void Graph<T>::resetVerticesFields() {
+    for (Vertex<T>& vertex : vertices) {
+        vertex.visited = false;
+        vertex.distance = INT32_MAX;
+        vertex.parent = nullptr;
+    }
+}
+
+template <typename T>
+void Graph<T>::reconstructPath(Vertex<T>* current, Vertex<T>* source,
+                               List<T>& path) const {
+    while (current != source) {
+        path.push_first(current->id);
+        current = current->parent;
+    }
+    path.push_first(current->id);
+}
+
+template<class T>
+bool Graph<T>::readAdjacencyMatrix(const AdjacencyMatrix& adjacencyMatrix) {
+    EASY_GRAPHS_TRACE("Graph::readAdjacencyMatrix");
+    if (adjacencyMatrix.size() != degree) {
+        return false; // Degree of the matrix and degree of the graph most be equal
+    }
+    for (const std::vector<int>& row : adjacencyMatrix) {
+        if (row.size() != degree) {
+            return false; // The matrix is not squared
+        }
+    }
+    // At this point the matrix accomplish the requirements
+    std::vector<Vertex<T>*> table = vertexTable();
+    for (size_t i = 0; i < degree; i++) {
+        table[i]->neighbors.clear();
+        for (size_t j = 0; j < degree; j++) {
+            if (adjacencyMatrix[i][j] != 0) {
+                table[i]->neighbors.append(
+                    NeighborVertex<T>(table[j], adjacencyMatrix[i][j]));
+            }
+        }
+    }
+    if (neighbor_sets) {
+        enableNeighborSets();
+    }
+    if (reverse_index) {
+        buildReverseIndex();
+    }
+    return true;
+}
+
+template <class T>
+AdjacencyMatrix Graph<T>::obtainAdjacencyMatrix() const {
+    AdjacencyMatrix adjacencyMatrix(degree, std::vector<int>(degree, 0));
+    for (const Vertex<T>& vertex : vertices) {
+        std::vector<int>& row = adjacencyMatrix[vertex.index];
+        for (const NeighborVertex<T>& neighbour : vertex.neighbors) {
+            row[neighbour.vertex->index] = weighted ? neighbour.weight : 1;
+        }
+    }
+    return adjacencyMatrix;
+}
+
+template <class T>
+bool Graph<T>::readSparseMatrix(const CsrMatrix& matrix) {
+    EASY_GRAPHS_TRACE("Graph::readSparseMatrix");
+    if (matrix.rows != degree or matrix.cols != degree or
+        matrix.offsets.size() != degree + 1 or matrix.offsets[0] != 0 or
+        matrix.offsets[degree] != matrix.columns.size() or
+        matrix.columns.size() != matrix.values.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < degree; i++) {
+        if (matrix.offsets[i] > matrix.offsets[i + 1]) {
+            return false;
+        }
+    }
+    for (uint32_t column : matrix.columns) {
+        if (column >= degree) {
+            return false;
+        }
+    }
+    std::vector<Vertex<T>*> table = vertexTable();
+    for (size_t i = 0; i < degree; i++) {
+        table[i]->neighbors.clear();
+        for (size_t e = matrix.offsets[i]; e < matrix.offsets[i + 1]; e++) {
+            table[i]->neighbors.append(
+                NeighborVertex<T>(table[matrix.columns[e]], matrix.values[e]));
+        }
+    }
+    if (neighbor_sets) {
+        enableNeighborSets();
+    }
+    if (reverse_index) {
+        buildReverseIndex();
+    }
+    return true;
+}
+
+template <class T>
+bool Graph<T>::readSparseMatrix(const CooMatrix& matrix) {
+    if (matrix.rows != degree or matrix.cols != degree or
+        matrix.row_indices.size() != matrix.values.size() or
+        matrix.column_indices.size() != matrix.values.size()) {
+        return false;
+    }
+    for (size_t k = 0; k < matrix.nonZeros(); k++) {
+        if (matrix.row_indices[k] >= degree or matrix.column_indices[k] >= degree) {
+            return false;
+        }
+    }
+    return readSparseMatrix(toCsr(matrix));
+}
+
+template <class T>
+CsrMatrix Graph<T>::obtainCsrMatrix() const {
+    CsrMatrix matrix;
+    matrix.rows = matrix.cols = degree;
+    compressedRows(matrix.offsets, matrix.columns, matrix.values, false);
+    if (not weighted) {
+        matrix.values.assign(matrix.columns.size(), 1);
+    }
+    return matrix;
+}
+
+template <class T>
+CooMatrix Graph<T>::obtainCooMatrix() const {
+    return toCoo(obtainCsrMatrix());
+}
+
+template <class T>
+void Graph<T>::bfs(Vertex<T>* root, Graph& resulting_tree, AlgorithmStats* stats) {
+    EASY_GRAPHS_TRACE("Graph::bfs");
+    StatsRecorder recorder(stats);
+    List<Vertex<T>*> queue = {root};
+    root->visited = true;
+    recorder.frontier(1);
+    while (!queue.isEmpty()) {
+        Vertex<T>* first = queue[0];
+        queue.pop_first();
+        recorder.visit();
+        for (NeighborVertex<T>& neighbour : first->neighbors) {
+            recorder.scan();
+            resulting_tree.newVertex(first->id);
+            if (!neighbour.vertex->visited) {
+                resulting_tree.newVertex(neighbour.vertex->id);
+                resulting_tree.newEdge(first->id, neighbour.vertex->id);
+                queue.append(neighbour.vertex);
+                neighbour.vertex->visited = true;
+            }
+        }
+        recorder.frontier(size_t(queue.getLength()));
+    }
+    resetVerticesFields();
+}
+
+template <class T>
+void Graph<T>::dfs(Vertex<T>* root, Graph& resulting_tree, AlgorithmStats* stats) {
+    EASY_GRAPHS_TRACE("Graph::dfs");
+    StatsRecorder recorder(stats);
+    List<Vertex<T>*> stack = {root};
+    root->visited = true;
+    recorder.frontier(1);
+    while (!stack.isEmpty()) {
+        Vertex<T>* first = stack[stack.getLength() - 1];
+        stack.pop();
+        recorder.visit();
+        for (NeighborVertex<T>& neighbour : first->neighbors) {
+            recorder.scan();
+            resulting_tree.newVertex(first->id);
+            if (!neighbour.vertex->visited) {
+                resulting_tree.newVertex(neighbour.vertex->id);
+                resulting_tree.newEdge(first->id, neighbour.vertex->id);
+                stack.append(neighbour.vertex);
+                neighbour.vertex->visited = true;
+            }
+        }
+        recorder.frontier(size_t(stack.getLength()));
+    }
+    resetVerticesFields();
+}
+
+template <typename T>
+void Graph<T>::prim(Vertex<T>* root, Graph& min_expansion_tree, AlgorithmStats* stats) {
+    EASY_GRAPHS_TRACE("Graph::prim");
+    StatsRecorder recorder(stats);
+    root->distance = 0;
+    MinHeap<HeapEntry> min_heap = {HeapEntry(0, root)};
+    recorder.push();
+    recorder.frontier(1);
+    while (not min_heap.empty()) {
+        Vertex<T>* best = min_heap.getMin().second;
+        min_heap.pop();
+        recorder.pop();
+        if (best->visited) { // stale entry
+            recorder.stale();
+            continue;
+        }
+        best->visited = true;
+        recorder.visit();
+        for (NeighborVertex<T>& neighbour : best->neighbors) {
+            recorder.scan();
+            if (neighbour.weight < neighbour.vertex->distance and
+                not neighbour.vertex->visited) {
+                neighbour.vertex->distance = neighbour.weight;
+                neighbour.vertex->parent = best;
+                min_heap.push(HeapEntry(neighbour.weight, neighbour.vertex));
+                recorder.relax();
+                recorder.push();
+            }
+        }
+        recorder.frontier(size_t(min_heap.size()));
+    }
+    for (const Vertex<T>& vertex : vertices) {
+        if (vertex.parent != nullptr and vertex.visited) {
+            min_expansion_tree.newVertex(vertex.id);
+            min_expansion_tree.newVertex(vertex.parent->id);
+            min_expansion_tree.newEdge(
+                                       vertex.parent->id, vertex.id, vertex.distance
+                                       );
+        }
+    }
+    resetVerticesFields();
+}
+
+template <typename T>
+void Graph<T>::dijkstra(Vertex<T>* source, AlgorithmStats* stats) {
+    EASY_GRAPHS_TRACE("Graph::dijkstra");
+    StatsRecorder recorder(stats);
+    source->distance = 0;
+    MinHeap<HeapEntry> min_heap = {HeapEntry(0, source)};
+    recorder.push();
+    recorder.frontier(1);
+    while (not min_heap.empty()) {
+        HeapEntry entry = min_heap.getMin();
+        Vertex<T>* best = entry.second;
+        min_heap.pop();
+        recorder.pop();
+        if (entry.first > best->distance) { // stale entry
+            recorder.stale();
+            continue;
+        }
+        recorder.visit();
+        for (NeighborVertex<T>& neighbour : best->neighbors) {
+            recorder.scan();
+            if (neighbour.weight + best->distance < neighbour.vertex->distance) {
+                neighbour.vertex->distance = neighbour.weight + best->distance;
+                neighbour.vertex->parent = best;
+                min_heap.push(HeapEntry(neighbour.vertex->distance, neighbour.vertex));
+                recorder.relax();
+                recorder.push();
+            }
+        }
+        recorder.frontier(size_t(min_heap.size()));
+    }
+}
+
+template <typename T>
+int Graph<T>::dijkstra(Vertex<T>* source, Vertex<T>* target, List<T>& path,
+                       AlgorithmStats* stats) {
+    EASY_GRAPHS_TRACE("Graph::dijkstra");
+    StatsRecorder recorder(stats);
+    source->distance = 0;
+    MinHeap<HeapEntry> min_heap = {HeapEntry(0, source)};
+    recorder.push();
+    recorder.frontier(1);
+    while (not min_heap.empty()) {
+        HeapEntry entry = min_heap.getMin();
+        Vertex<T>* best = entry.second;
+        min_heap.pop();
+        recorder.pop();
+        if (entry.first > best->distance) { // stale entry
+            recorder.stale();
+            continue;
+        }
+        recorder.visit();
+        if (best == target) {
+            reconstructPath(best, source, path);
+            return best->distance;
+        }
+        for (NeighborVertex<T>& neighbour : best->neighbors) {
+            recorder.scan();
+            if (neighbour.weight + best->distance < neighbour.vertex->distance) {
+                neighbour.vertex->distance = neighbour.weight + best->distance;
+                neighbour.vertex->parent = best;
+                min_heap.push(HeapEntry(neighbour.vertex->distance, neighbour.vertex));
+                recorder.relax();
+                recorder.push();
+            }
+        }
+        recorder.frontier(size_t(min_heap.size()));
+    }
+    return -1; // No path finded
+}
+
+template <typename T>
+bool Graph<T>::bellmanFord(Vertex<T>* source) {
+    List<Vertex<T>*> queue = {source};
+    return bellmanFord(queue);
+}
+
+template <typename T>
+bool Graph<T>::bellmanFord(List<Vertex<T>*>& queue) {
+    EASY_GRAPHS_TRACE("Graph::bellmanFord");
+    // visited marks the vertices inside the queue, edges[i] is the number of
+    // edges of the current best path to the vertex with index i. A shortest
+    // path can't have degree edges or more, unless there is a negative cycle.
+    std::vector<size_t> edges(degree, 0);
+    for (Vertex<T>* source : queue) {
+        source->distance = 0;
+        source->visited = true;
+    }
+    bool negative_cycle = false;
+    while (not queue.isEmpty() and not negative_cycle) {
+        Vertex<T>* first = queue[0];
+        queue.pop_first();
+        first->visited = false;
+        for (NeighborVertex<T>& neighbour : first->neighbors) {
+            Vertex<T>* vertex = neighbour.vertex;
+            if (neighbour.weight + first->distance < vertex->distance) {
+                vertex->distance = neighbour.weight + first->distance;
+                vertex->parent = first;
+                edges[vertex->index] = edges[first->index] + 1;
+                if (edges[vertex->index] >= degree) {
+                    negative_cycle = true;
+                    break;
+                }
+                if (not vertex->visited) {
+                    vertex->visited = true;
+                    queue.append(vertex);
+                }
+            }
+        }
+    }
+    for (Vertex<T>* vertex : queue) {
+        vertex->visited = false;
+    }
+    return not negative_cycle;
+}
+
+template <typename T>
+bool Graph<T>::parallelBellmanFord(Vertex<T>* source, unsigned num_threads) {
+    EASY_GRAPHS_TRACE("Graph::parallelBellmanFord");
+    // Distance and parent index of each vertex packed in one atomic word, the
+    // distance in the high half with its sign bit flipped, so comparing the
+    // words compares the distances and both fields are updated at once.
+    const uint32_t NO_PARENT = UINT32_MAX;
+    auto pack = [](int distance, uint32_t parent) -> uint64_t {
+        return (uint64_t(uint32_t(distance) ^ 0x80000000u) << 32) | parent;
+    };
+    auto unpackDistance = [](uint64_t word) -> int {
+        return int(uint32_t(word >> 32) ^ 0x80000000u);
+    };
+
+    std::vector<Vertex<T>*> table = vertexTable();
+    std::vector<std::atomic<uint64_t>> best(degree);
+    std::vector<std::atomic<bool>> in_next(degree);
+    for (size_t i = 0; i < degree; i++) {
+        best[i].store(pack(INT32_MAX, NO_PARENT), std::memory_order_relaxed);
+        in_next[i].store(false, std::memory_order_relaxed);
+    }
+    best[source->index].store(pack(0, NO_PARENT));
+
+    unsigned threads = resolveThreadCount(num_threads);
+    std::vector<std::vector<uint32_t>> next(threads);
+    std::vector<uint32_t> frontier = {uint32_t(source->index)};
+    size_t round = 0;
+    for (; not frontier.empty() and round < degree; round++) {
+        parallelFor(0, frontier.size(), threads,
+                    [&](unsigned thread, size_t lo, size_t hi) {
+            std::vector<uint32_t>& local = next[thread];
+            for (size_t i = lo; i < hi; i++) {
+                uint32_t u = frontier[i];
+                int distance = unpackDistance(best[u].load(std::memory_order_relaxed));
+                for (const NeighborVertex<T>& neighbour : table[u]->neighbors) {
+                    uint32_t v = uint32_t(neighbour.vertex->index);
+                    uint64_t candidate = pack(distance + neighbour.weight, u);
+                    uint64_t current = best[v].load(std::memory_order_relaxed);
+                    while ((candidate >> 32) < (current >> 32) and
+                           not best[v].compare_exchange_weak(current, candidate,
+                                                             std::memory_order_relaxed)) {
+                    }
+                    if ((candidate >> 32) < (current >> 32) and
+                        not in_next[v].exchange(true, std::memory_order_relaxed)) {
+                        local.push_back(v);
+                    }
+                }
+            }
+        });
+        frontier.clear();
+        for (std::vector<uint32_t>& local : next) {
+            for (uint32_t v : local) {
+                in_next[v].store(false, std::memory_order_relaxed);
+            }
+            frontier.insert(frontier.end(), local.begin(), local.end());
+            local.clear();
+        }
+    }
+
+    for (size_t i = 0; i < degree; i++) {
+        uint64_t word = best[i].load(std::memory_order_relaxed);
+        uint32_t parent = uint32_t(word);
+        table[i]->distance = unpackDistance(word);
+        table[i]->parent = parent == NO_PARENT ? nullptr : table[parent];
+    }
+    return frontier.empty(); // still improving after degree rounds
+}
+
+template <typename T>
+void Graph<T>::bfs_animation(Vertex<T>* root, List<std::string>& animation,
+                             AlgorithmStats* stats) {
+    AnimationFrames<T> frames;
+    traversalFrames(root, true, frames, stats);
+    for (const std::string& frame : frames) {
+        animation.append(frame);
+    }
+}
+
+template <class T>
+void Graph<T>::dfs_animation(Vertex<T>* root, List<std::string>& animation,
+                             AlgorithmStats* stats) {
+    AnimationFrames<T> frames;
+    traversalFrames(root, false, frames, stats);
+    for (const std::string& frame : frames) {
+        animation.append(frame);
+    }
+}
+
+template <typename T>
+void Graph<T>::traversalFrames(Vertex<T>* root, bool breadth,
+                               AnimationFrames<T>& frames, AlgorithmStats* stats) {
+    EASY_GRAPHS_TRACE("Graph::traversalFrames");
+    StatsRecorder recorder(stats);
+    frames = AnimationFrames<T>(root->id);
+    // Position of every discovered vertex in the frames
+    std::vector<uint32_t> position(degree, 0);
+    List<Vertex<T>*> pending = {root}; // queue for bfs, stack for dfs
+    root->visited = true;
+    recorder.frontier(1);
+    while (!pending.isEmpty()) {
+        Vertex<T>* first;
+        if (breadth) {
+            first = pending[0];
+            pending.pop_first();
+        } else {
+            first = *rbegin(pending);
+            pending.pop();
+        }
+        recorder.visit();
+        for (NeighborVertex<T>& neighbour : first->neighbors) {
+            recorder.scan();
+            if (!neighbour.vertex->visited) {
+                position[neighbour.vertex->index] = uint32_t(frames.size());
+                frames.addEdge(position[first->index], neighbour.vertex->id);
+                pending.append(neighbour.vertex);
+                neighbour.vertex->visited = true;
+            }
+        }
+        recorder.frontier(size_t(pending.getLength()));
+    }
+    resetVerticesFields();
+}
+
+template <typename T>
+void Graph<T>::dijkstra_animation(Vertex<T>* source,
+                                  List<std::string>& animation, AlgorithmStats* stats) {
+    DijkstraTrace<T> trace;
+    dijkstraTrace(source, trace, stats);
+    for (const std::string& frame : trace) {
+        animation.append(frame);
+    }
+}
+
+template <typename T>
+void Graph<T>::dijkstraTrace(Vertex<T>* source, DijkstraTrace<T>& trace,
+                             AlgorithmStats* stats) {
+    EASY_GRAPHS_TRACE("Graph::dijkstraTrace");
+    StatsRecorder recorder(stats);
+    std::vector<Vertex<T>*> table = vertexTable();
+    std::vector<T> ids;
+    for (const Vertex<T>* vertex : table) {
+        ids.push_back(vertex->id);
+    }
+    std::vector<size_t> offsets;
+    std::vector<uint32_t> targets;
+    std::vector<int> weights;
+    compressedRows(offsets, targets, weights, false);
+    trace = DijkstraTrace<T>(weighted, directed, ids, std::move(offsets),
+                             std::move(targets), std::move(weights),
+                             uint32_t(source->index));
+    source->distance = 0;
+    MinHeap<HeapEntry> min_heap = {HeapEntry(0, source)};
+    recorder.push();
+    recorder.frontier(1);
+    while (! min_heap.empty()) {
+        HeapEntry entry = min_heap.getMin();
+        Vertex<T>* best = entry.second;
+        min_heap.pop();
+        recorder.pop();
+        if (entry.first > best->distance) { // stale entry
+            recorder.stale();
+            continue;
+        }
+        recorder.visit();
+        trace.record(DijkstraEvent(DijkstraEvent::SETTLED, uint32_t(best->index),
+                                   best->distance, best->parent == nullptr ?
+                                   uint32_t(best->index) : uint32_t(best->parent->index)));
+        for (NeighborVertex<T>& neighbour : best->neighbors) {
+            recorder.scan();
+            if (neighbour.weight + best->distance < neighbour.vertex->distance) {
+                neighbour.vertex->distance = neighbour.weight + best->distance;
+                neighbour.vertex->parent = best;
+                min_heap.push(HeapEntry(neighbour.vertex->distance, neighbour.vertex));
+                recorder.relax();
+                recorder.push();
+                trace.record(DijkstraEvent(DijkstraEvent::RELAXED,
+                                           uint32_t(neighbour.vertex->index),
+                                           neighbour.vertex->distance,
+                                           uint32_t(best->index)));
+            }
+        }
+        recorder.frontier(size_t(min_heap.size()));
+    }
+}
+
+template <typename T>
+MemoryUsage Graph<T>::memoryUsage() const {
+    typedef Node<Vertex<T>> VertexNode;
+    typedef Node<NeighborVertex<T>> NeighborNode;
+    MemoryUsage usage;
+    usage.vertex_storage = sizeof(Graph);
+    for (const Vertex<T>& vertex : vertices) {
+        usage.vertex_storage += sizeof(VertexNode) - sizeof(T);
+        usage.allocator_overhead += allocationOverhead(sizeof(VertexNode));
+        size_t id_bytes = DynamicMemory<T>::bytes(vertex.id);
+        usage.id_storage += sizeof(T) + id_bytes;
+        if (id_bytes > 0) {
+            usage.allocator_overhead += allocationOverhead(id_bytes);
+        }
+        size_t entries = size_t(vertex.neighbors.getLength()) +
+                         size_t(vertex.predecessors.getLength());
+        usage.neighbor_nodes += entries * sizeof(NeighborNode);
+        usage.allocator_overhead += entries * allocationOverhead(sizeof(NeighborNode));
+        size_t set_bytes = vertex.neighbor_set.memoryUsage();
+        if (set_bytes > 0) {
+            usage.neighbor_sets += set_bytes;
+            usage.allocator_overhead += allocationOverhead(set_bytes);
+        }
+    }
+    return usage;
+}
+
+template <typename T> typename List<Vertex<T>>::Iterator
+Graph<T>::getIteratorOf(const T& vertex_id) const {
+    EASY_GRAPHS_TRACE("Graph::getIteratorOf");
+    for (auto it = begin(vertices); it != end(vertices); it++) {
+        if (it->id == vertex_id) {
+            return it;
+        }
+    }
+    return List<Vertex<T>>::NO_ELEMENT;
+}
+
+template <typename T>
+std::vector<Vertex<T>*> Graph<T>::vertexTable() const {
+    std::vector<Vertex<T>*> table(degree, nullptr);
+    for (Vertex<T>& vertex : vertices) {
+        table[vertex.index] = &vertex;
+    }
+    return table;
+}
+
+template <typename T>
+long Graph<T>::indexOf(const T& vertex_id) const {
+    auto it = getIteratorOf(vertex_id);
+    return it == end(vertices) ? -1 : long(it->index);
+}
+
+template <typename T>
+template <typename Reweight>
+Graph<T> Graph<T>::reweightedCopy(Reweight reweight) const {
+    Graph copy(weighted, directed);
+    std::vector<Vertex<T>*> table = vertexTable();
+    for (size_t i = 0; i < degree; i++) {
+        copy.vertices.append(Vertex<T>(table[i]->id, i));
+    }
+    copy.degree = degree;
+    std::vector<Vertex<T>*> copy_table = copy.vertexTable();
+    for (size_t i = 0; i < degree; i++) {
+        for (const NeighborVertex<T>& neighbour : table[i]->neighbors) {
+            size_t j = neighbour.vertex->index;
+            copy_table[i]->neighbors.append(
+                NeighborVertex<T>(copy_table[j], reweight(i, j, neighbour.weight)));
+        }
+    }
+    if (neighbor_sets) {
+        copy.enableNeighborSets();
+    }
+    if (reverse_index) {
+        copy.enableReverseIndex();
+    }
+    return copy;
+}
+
+template <typename T>
+void Graph<T>::compressedRows(std::vector<size_t>& offsets,
+                              std::vector<uint32_t>& targets,
+                              std::vector<int>& weights, bool transposed) const {
+    offsets.assign(degree + 1, 0);
+    for (const Vertex<T>& vertex : vertices) {
+        for (const NeighborVertex<T>& neighbour : vertex.neighbors) {
+            offsets[(transposed ? neighbour.vertex->index : vertex.index) + 1]++;
+        }
+    }
+    for (size_t i = 0; i < degree; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+    targets.resize(offsets[degree]);
+    weights.resize(weighted ? offsets[degree] : 0);
+    std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+    for (const Vertex<T>& vertex : vertices) {
+        for (const NeighborVertex<T>& neighbour : vertex.neighbors) {
+            size_t row = transposed ? neighbour.vertex->index : vertex.index;
+            size_t column = transposed ? vertex.index : neighbour.vertex->index;
+            size_t position = next[row]++;
+            targets[position] = uint32_t(column);
+            if (weighted) {
+                weights[position] = neighbour.weight;
+            }
+        }
+    }
+}
+
+template <typename T>
+Graph<T> Graph<T>::inducedSubgraph(const std::vector<bool>& keep) const {
+    Graph subgraph(weighted, directed);
+    std::vector<Vertex<T>*> table = vertexTable();
+    std::vector<Vertex<T>*> copies(degree, nullptr);
+    for (size_t i = 0; i < degree; i++) {
+        if (i < keep.size() and keep[i]) {
+            subgraph.vertices.append(Vertex<T>(table[i]->id, subgraph.degree));
+            copies[i] = &(*rbegin(subgraph.vertices));
+            subgraph.degree++;
+        }
+    }
+    // Neighbours are appended by hand, the index is built at the end
+    for (size_t i = 0; i < degree; i++) {
+        if (copies[i] == nullptr) continue;
+        for (const NeighborVertex<T>& neighbour : table[i]->neighbors) {
+            Vertex<T>* target = copies[neighbour.vertex->index];
+            if (target != nullptr) {
+                copies[i]->neighbors.append(NeighborVertex<T>(target, neighbour.weight));
+            }
+        }
+    }
+    if (neighbor_sets) {
+        subgraph.enableNeighborSets();
+    }
+    if (reverse_index) {
+        subgraph.enableReverseIndex();
+    }
+    return subgraph;
+}
+
+template <class T>
+std::string Graph<T>::dotRepr(GraphDrawingMode drawingMode) const {
+    EASY_GRAPHS_TRACE("Graph::dotRepr");
+    std::ostringstream ss;
+    writeDot(ss, drawingMode);
+    return ss.str();
+}
+
+template <class T>
+template <typename Sink>
+void Graph<T>::writeDot(Sink& out, GraphDrawingMode drawingMode) const {
+    EASY_GRAPHS_TRACE("Graph::writeDot");
+    if (degree == 0) return;
+
+    out << (directed ? "digraph " : "strict graph ") << " {\n";
+    const char* edge_op = directed ? "\" -> \"" : "\" -- \"";
+    for (const Vertex<T>& vertex : vertices) {
+        if (vertex.neighbors.isEmpty()) {
+            out << "\t\"" << vertex.id << "\"\n";
+            continue;
+        }
+        for (const NeighborVertex<T>& neighbor : vertex.neighbors) {
+            switch (drawingMode) {
+                case GraphDrawingMode::DEFAULT:
+                    out << "\t\"" << vertex.id << edge_op << neighbor.vertex->id << "\"  [";
+                    break;
+                case GraphDrawingMode::SHOW_DISTANCES:
+                    out << "\t\"" << vertex.id << " | ";
+                    writeDistance(out, vertex.distance);
+                    out << edge_op << neighbor.vertex->id << " | ";
+                    writeDistance(out, neighbor.vertex->distance);
+                    out << "\" [";
+                    break;
+            }
+            if (weighted) {
+                out << "taillabel = \"" << neighbor.weight << "\", ";
+            }
+            out << "labeldistance = 1.5]\n";
+        }
+    }
+    out << "}";
+}
+
+} // easy_graphs namespace end
+
+#endif // GRAPH_H
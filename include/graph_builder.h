@@ -0,0 +1,239 @@
+#ifndef GRAPH_BUILDER_H
+#define GRAPH_BUILDER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "graph.h"
+#include "adjacency_snapshot.h"
+#include "parallel.h"
+#include "trace.h"
+
+namespace easy_graphs {
+
+/*
+  Collects the edges of a graph in flat arrays and builds its adjacency in
+  one go: the edges are grouped by source with a counting sort (parallel
+  when num_threads != 1) and every row keeps the order in which its edges
+  were added, as if they were added one by one with Graph::newEdge.
+  Vertices are numbered by first appearance, unknown ids used by an edge
+  become new vertices. T must be usable as a key of std::unordered_map.
+ */
+template<class T>
+class GraphBuilder {
+ public:
+  explicit GraphBuilder(bool weighted = false, bool directed = false)
+      : weighted(weighted), directed(directed) {}
+
+  bool isWeighted() const { return weighted; }
+
+  bool isDirected() const { return directed; }
+
+  size_t vertexCount() const { return ids.size(); }
+
+  // Edges added, each undirected edge counts once
+  size_t edgeCount() const { return sources.size(); }
+
+  /*
+    Turning the weights off drops those of the edges already added,
+    turning them on gives them weight 1
+   */
+  void setWeighted(bool weighted) {
+    if (weighted and not this->weighted) {
+      weights.assign(sources.size(), 1);
+    } else if (not weighted) {
+      std::vector<int>().swap(weights);
+    }
+    this->weighted = weighted;
+  }
+
+  // Threads used by the builds, 0 = hardware concurrency
+  void setThreads(unsigned num_threads) { this->num_threads = num_threads; }
+
+  void reserve(size_t vertices, size_t edges) {
+    ids.reserve(vertices);
+    index.reserve(vertices);
+    sources.reserve(edges);
+    targets.reserve(edges);
+    if (weighted) weights.reserve(edges);
+  }
+
+  /*
+    Index of a vertex, added if it was not there yet.
+    Complexity: O(1) expected
+   */
+  uint32_t addVertex(const T& id) {
+    auto inserted = index.insert(std::make_pair(id, uint32_t(ids.size())));
+    if (inserted.second) {
+      ids.push_back(id);
+    }
+    return inserted.first->second;
+  }
+
+  void addEdge(const T& source_id, const T& target_id, int weight = 1) {
+    uint32_t source = addVertex(source_id);
+    addEdgeByIndex(source, addVertex(target_id), weight);
+  }
+
+  /*
+    Edge between vertices already added, by their indices, for loaders
+    which number the vertices themselves. Complexity: O(1) amortized
+   */
+  void addEdgeByIndex(uint32_t source, uint32_t target, int weight = 1) {
+    sources.push_back(source);
+    targets.push_back(target);
+    if (weighted) weights.push_back(weight);
+  }
+
+  /*
+    Adds a range of std::pair<T, T> or std::tuple<T, T, int>, the pairs
+    have weight 1
+   */
+  template <typename Range>
+  void addEdges(const Range& edges) {
+    for (const auto& edge : edges) {
+      addEdge(std::get<0>(edge), std::get<1>(edge), edgeWeight(edge));
+    }
+  }
+
+  /*
+    Appends edges by index built elsewhere (e.g. by one parser per thread),
+    weights may be empty for unweighted builders.
+   */
+  void appendEdges(const std::vector<uint32_t>& more_sources,
+                   const std::vector<uint32_t>& more_targets,
+                   const std::vector<int>& more_weights = {});
+
+  /*
+    Adjacency in compressed sparse rows, undirected edges are stored in
+    both rows. Complexity: O(V + E)
+   */
+  AdjacencySnapshot<T> buildSnapshot() const;
+
+  /*
+    The graph with its adjacency lists filled row by row, without any
+    search of vertices. Complexity: O(V + E)
+   */
+  Graph<T> build() const;
+
+  void clear() {
+    ids.clear();
+    index.clear();
+    sources.clear();
+    targets.clear();
+    weights.clear();
+  }
+
+ private:
+  // Groups the edges by source into offsets, columns and column weights
+  void sortEdges(std::vector<size_t>& offsets, std::vector<uint32_t>& columns,
+                 std::vector<int>& column_weights) const;
+
+  bool weighted;
+  bool directed;
+  unsigned num_threads = 0;
+  std::vector<T> ids;
+  std::unordered_map<T, uint32_t> index;
+  std::vector<uint32_t> sources;
+  std::vector<uint32_t> targets;
+  std::vector<int> weights; // empty for unweighted builders
+};
+
+// ----------------- IMPLEMENTATION --------------------
+
+template <typename T>
+void GraphBuilder<T>::appendEdges(const std::vector<uint32_t>& more_sources,
+                                  const std::vector<uint32_t>& more_targets,
+                                  const std::vector<int>& more_weights) {
+    sources.insert(sources.end(), more_sources.begin(), more_sources.end());
+    targets.insert(targets.end(), more_targets.begin(), more_targets.end());
+    if (weighted) {
+        if (more_weights.size() == more_sources.size()) {
+            weights.insert(weights.end(), more_weights.begin(), more_weights.end());
+        } else {
+            weights.resize(sources.size(), 1);
+        }
+    }
+}
+
+template <typename T>
+void GraphBuilder<T>::sortEdges(std::vector<size_t>& offsets,
+                                std::vector<uint32_t>& columns,
+                                std::vector<int>& column_weights) const {
+    size_t size = ids.size();
+    size_t edges = sources.size();
+    size_t entries = directed ? edges : 2 * edges;
+    // One row of counters per thread, too many threads for few edges per
+    // vertex would spend more time on the counters than on the edges
+    unsigned threads = resolveThreadCount(num_threads);
+    threads = unsigned(std::max<size_t>(1, std::min<size_t>(threads, entries / (size + 1))));
+    const size_t GRAIN = 1 << 16;
+    std::vector<std::vector<size_t>> next(threads);
+
+    // Phase 1: entries per row and per slice of the edges
+    parallelFor(0, edges, threads, [&](unsigned thread, size_t lo, size_t hi) {
+        std::vector<size_t>& count = next[thread];
+        count.assign(size, 0);
+        for (size_t e = lo; e < hi; e++) {
+            count[sources[e]]++;
+            if (not directed) count[targets[e]]++;
+        }
+    }, GRAIN);
+    // Phase 2: where every slice writes in every row, slices in order
+    offsets.assign(size + 1, 0);
+    for (size_t v = 0; v < size; v++) {
+        size_t position = offsets[v];
+        for (std::vector<size_t>& count : next) {
+            if (count.empty()) continue;
+            size_t amount = count[v];
+            count[v] = position;
+            position += amount;
+        }
+        offsets[v + 1] = position;
+    }
+    // Phase 3: scatter, every row keeps the order of the edges
+    columns.resize(entries);
+    column_weights.resize(weighted ? entries : 0);
+    parallelFor(0, edges, threads, [&](unsigned thread, size_t lo, size_t hi) {
+        std::vector<size_t>& position = next[thread];
+        for (size_t e = lo; e < hi; e++) {
+            size_t forward = position[sources[e]]++;
+            columns[forward] = targets[e];
+            if (weighted) column_weights[forward] = weights[e];
+            if (not directed) {
+                size_t backward = position[targets[e]]++;
+                columns[backward] = sources[e];
+                if (weighted) column_weights[backward] = weights[e];
+            }
+        }
+    }, GRAIN);
+}
+
+template <typename T>
+AdjacencySnapshot<T> GraphBuilder<T>::buildSnapshot() const {
+    EASY_GRAPHS_TRACE("GraphBuilder::buildSnapshot");
+    std::vector<size_t> offsets;
+    std::vector<uint32_t> columns;
+    std::vector<int> column_weights;
+    sortEdges(offsets, columns, column_weights);
+    return AdjacencySnapshot<T>(weighted, directed, ids, std::move(offsets),
+                                std::move(columns), std::move(column_weights));
+}
+
+template <typename T>
+Graph<T> GraphBuilder<T>::build() const {
+    EASY_GRAPHS_TRACE("GraphBuilder::build");
+    std::vector<size_t> offsets;
+    std::vector<uint32_t> columns;
+    std::vector<int> column_weights;
+    sortEdges(offsets, columns, column_weights);
+    return Graph<T>::fromRows(weighted, directed, ids, offsets, columns, column_weights);
+}
+
+} // easy_graphs namespace end
+
+#endif // GRAPH_BUILDER_H
@@ -0,0 +1,484 @@
+/*
+  Binary format of a graph in compressed sparse rows, made to be memory
+  mapped: opening a file only checks its header, the rows are read in place
+  from the page cache, which is shared by every process mapping the file.
+
+  Layout (version 1, native byte order, every section aligned to 64 bytes):
+    header    BinaryGraphHeader
+    ids       vertex_count ids, encoded by BinaryIds<T>
+    offsets   vertex_count + 1 uint64_t, row i is [offsets[i], offsets[i + 1])
+    targets   edge_count uint32_t
+    weights   edge_count int32_t, only for weighted graphs with edges
+  Each section has its checksum in the header, and the header its own.
+ */
+
+#ifndef BINARY_GRAPH_H
+#define BINARY_GRAPH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../adjacency_snapshot.h"
+#include "mapped_file.h"
+
+namespace easy_graphs {
+
+  struct BinaryGraphHeader {
+    static const uint32_t VERSION = 1;
+    static const uint32_t ENDIANNESS = 0x01020304;
+    static const uint32_t WEIGHTED = 1;
+    static const uint32_t DIRECTED = 2;
+    static const uint32_t TRANSPOSED = 4;
+
+    char magic[8];        // "EGRAPHS" and a null character
+    uint32_t version;
+    uint32_t endianness;  // ENDIANNESS as written by the machine
+    uint32_t flags;
+    uint32_t id_kind;     // BinaryIds<T>::KIND
+    uint64_t id_size;     // bytes of each fixed size id, 0 otherwise
+    uint64_t vertex_count;
+    uint64_t edge_count;  // entries of the rows, undirected edges count twice
+    uint64_t ids_offset;
+    uint64_t ids_bytes;
+    uint64_t offsets_offset;
+    uint64_t targets_offset;
+    uint64_t weights_offset;  // 0 for unweighted graphs
+    uint64_t file_size;
+    uint64_t ids_checksum;
+    uint64_t offsets_checksum;
+    uint64_t targets_checksum;
+    uint64_t weights_checksum;
+    uint64_t header_checksum; // of the bytes before this field
+  };
+
+  /*
+    64 bit checksum of a byte stream, fed in pieces of any size.
+    Words of 8 bytes are mixed with multiply and rotate steps, fast enough
+    to check gigabytes at memory speed. Not a cryptographic hash.
+   */
+  class Checksum {
+  public:
+    void update(const void* data, size_t size) {
+      const unsigned char* bytes = static_cast<const unsigned char*>(data);
+      length += size;
+      while (size > 0 and pending_bytes != 0) {
+        pending |= uint64_t(*bytes++) << (8 * pending_bytes);
+        size--;
+        if (++pending_bytes == 8) {
+          mix(pending);
+          pending = 0;
+          pending_bytes = 0;
+        }
+      }
+      for (; size >= 8; bytes += 8, size -= 8) {
+        uint64_t word;
+        std::memcpy(&word, bytes, 8);
+        mix(word);
+      }
+      for (; size > 0; size--) {
+        pending |= uint64_t(*bytes++) << (8 * pending_bytes++);
+      }
+    }
+
+    uint64_t value() const {
+      uint64_t result = state;
+      if (pending_bytes != 0) {
+        result = step(result, pending);
+      }
+      result ^= length;
+      result ^= result >> 33;
+      result *= 0xFF51AFD7ED558CCDULL;
+      result ^= result >> 33;
+      result *= 0xC4CEB9FE1A85EC53ULL;
+      return result ^ (result >> 33);
+    }
+
+    static uint64_t of(const void* data, size_t size) {
+      Checksum checksum;
+      checksum.update(data, size);
+      return checksum.value();
+    }
+
+  private:
+    static uint64_t step(uint64_t state, uint64_t word) {
+      state ^= word * 0x87C37B91114253D5ULL;
+      state = (state << 31) | (state >> 33);
+      return state * 0x4CF5AD432745937FULL + 0x52DCE729;
+    }
+
+    void mix(uint64_t word) { state = step(state, word); }
+
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    uint64_t pending = 0;
+    unsigned pending_bytes = 0;
+    uint64_t length = 0;
+  };
+
+  /*
+    Encoding of the ids section. Arithmetic ids are stored as an array,
+    std::string ids as vertex_count + 1 uint64_t offsets followed by the
+    characters. Specialize it to store other id types.
+   */
+  template <typename T, typename Enable = void>
+  struct BinaryIds;
+
+  template <typename T>
+  struct BinaryIds<T, typename std::enable_if<std::is_arithmetic<T>::value>::type> {
+    static const uint32_t KIND = 1;
+    static const uint64_t SIZE = sizeof(T);
+
+    static std::vector<char> encode(const std::vector<T>& ids) {
+      std::vector<char> bytes(ids.size() * sizeof(T));
+      if (not ids.empty()) std::memcpy(bytes.data(), ids.data(), bytes.size());
+      return bytes;
+    }
+
+    static bool check(const char*, uint64_t bytes, uint64_t count) {
+      return count <= bytes / sizeof(T) and bytes == count * sizeof(T);
+    }
+
+    static T decode(const char* data, uint64_t, size_t vertex) {
+      T id;
+      std::memcpy(&id, data + vertex * sizeof(T), sizeof(T));
+      return id;
+    }
+  };
+
+  template <>
+  struct BinaryIds<std::string> {
+    static const uint32_t KIND = 2;
+    static const uint64_t SIZE = 0;
+
+    static std::vector<char> encode(const std::vector<std::string>& ids) {
+      std::vector<uint64_t> starts(ids.size() + 1, 0);
+      for (size_t v = 0; v < ids.size(); v++) {
+        starts[v + 1] = starts[v] + ids[v].size();
+      }
+      size_t table = starts.size() * sizeof(uint64_t);
+      std::vector<char> bytes(table + starts.back());
+      std::memcpy(bytes.data(), starts.data(), table);
+      for (size_t v = 0; v < ids.size(); v++) {
+        std::memcpy(bytes.data() + table + starts[v], ids[v].data(), ids[v].size());
+      }
+      return bytes;
+    }
+
+    // Every offset in order and inside the characters, so decode can not go out
+    static bool check(const char* data, uint64_t bytes, uint64_t count) {
+      if (count >= bytes / sizeof(uint64_t)) return false;
+      uint64_t characters = bytes - (count + 1) * sizeof(uint64_t);
+      uint64_t previous = 0;
+      for (uint64_t v = 0; v <= count; v++) {
+        uint64_t start;
+        std::memcpy(&start, data + v * sizeof(uint64_t), sizeof(start));
+        if (start < previous or start > characters or (v == 0 and start != 0)) return false;
+        previous = start;
+      }
+      return previous == characters;
+    }
+
+    static std::string decode(const char* data, uint64_t count, size_t vertex) {
+      uint64_t range[2];
+      std::memcpy(range, data + vertex * sizeof(uint64_t), sizeof(range));
+      const char* characters = data + (count + 1) * sizeof(uint64_t);
+      return std::string(characters + range[0], characters + range[1]);
+    }
+  };
+
+  /*
+    Writes a snapshot in the binary format, false if the file can not be
+    written. Complexity: O(V + E)
+   */
+  template <typename T>
+  bool writeBinaryGraph(const std::string& path, const AdjacencySnapshot<T>& graph);
+
+  template <typename T>
+  bool writeBinaryGraph(const std::string& path, const Graph<T>& graph) {
+    return writeBinaryGraph(path, AdjacencySnapshot<T>(graph));
+  }
+
+  /*
+    Read-only graph over a memory mapped binary file, with the accessors of
+    AdjacencySnapshot. Rows, targets and weights are read in place, ids are
+    decoded on demand. open only checks the header and the bounds of the
+    sections: the row accessors (degree, rowBegin, rowEnd, target and
+    weight) are unchecked unless the file was opened with verify, or
+    verify() returned true, which also checks that the rows are in order
+    and the targets are vertices.
+   */
+  template<class T>
+  class BinaryGraphView {
+  public:
+    BinaryGraphView() {}
+
+    explicit BinaryGraphView(const std::string& path, bool verify = false) {
+      open(path, verify);
+    }
+
+    /*
+      Maps a file and checks its header and the bounds of its sections,
+      and every offset of std::string ids. With verify the checksums of
+      the whole file are checked too.
+      Complexity: O(1), O(V) for std::string ids, O(size of the file) with verify
+     */
+    bool open(const std::string& path, bool verify = false);
+
+    void close() {
+      file.close();
+      header = nullptr;
+    }
+
+    bool isOpen() const { return header != nullptr; }
+
+    // Checks the checksums of every section. Complexity: O(size of the file)
+    bool verify() const;
+
+    size_t size() const { return size_t(header->vertex_count); }
+
+    size_t edgeCount() const { return size_t(header->edge_count); }
+
+    bool isWeighted() const { return header->flags & BinaryGraphHeader::WEIGHTED; }
+
+    bool isDirected() const { return header->flags & BinaryGraphHeader::DIRECTED; }
+
+    bool isTransposed() const { return header->flags & BinaryGraphHeader::TRANSPOSED; }
+
+    T getId(size_t vertex) const {
+      return BinaryIds<T>::decode(ids, header->vertex_count, vertex);
+    }
+
+    size_t degree(size_t vertex) const {
+      return size_t(offsets[vertex + 1] - offsets[vertex]);
+    }
+
+    size_t rowBegin(size_t vertex) const { return size_t(offsets[vertex]); }
+    size_t rowEnd(size_t vertex) const { return size_t(offsets[vertex + 1]); }
+
+    uint32_t target(size_t edge) const { return targets[edge]; }
+
+    int weight(size_t edge) const { return weights == nullptr ? 1 : weights[edge]; }
+
+    /*
+      Copies of the file in memory, empty if the rows are not in order or
+      a target is not a vertex (checked even without verify).
+      Complexity: O(V + E)
+     */
+    AdjacencySnapshot<T> toSnapshot() const;
+    Graph<T> toGraph() const;
+
+  private:
+    // Rows in order and targets in range, so the accessors can not go out
+    bool wellFormed() const;
+
+    MappedFile file;
+    const BinaryGraphHeader* header = nullptr;
+    const char* ids = nullptr;
+    const uint64_t* offsets = nullptr;
+    const uint32_t* targets = nullptr;
+    const int32_t* weights = nullptr;
+  };
+
+// ----------------- IMPLEMENTATION --------------------
+
+namespace binary_graph {
+
+  const uint64_t ALIGNMENT = 64;
+
+  inline uint64_t align(uint64_t position) {
+    return (position + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+  }
+
+  // Section of count items of item_size bytes at offset inside a file of
+  // size bytes, written so that nothing can wrap around
+  inline bool fits(uint64_t offset, uint64_t count, uint64_t item_size, uint64_t size) {
+    return count <= size / item_size and offset <= size - count * item_size;
+  }
+
+  inline uint64_t headerChecksum(const BinaryGraphHeader& header) {
+    return Checksum::of(&header, offsetof(BinaryGraphHeader, header_checksum));
+  }
+
+  // Writes a section at position, padding from the current end of the file
+  inline void writeSection(std::ofstream& out, uint64_t& end, uint64_t position,
+                           const void* data, uint64_t bytes) {
+    static const char zeros[ALIGNMENT] = {};
+    out.write(zeros, std::streamsize(position - end));
+    out.write(static_cast<const char*>(data), std::streamsize(bytes));
+    end = position + bytes;
+  }
+
+} // binary_graph namespace end
+
+template <typename T>
+bool writeBinaryGraph(const std::string& path, const AdjacencySnapshot<T>& graph) {
+    EASY_GRAPHS_TRACE("writeBinaryGraph");
+    using namespace binary_graph;
+    std::vector<char> encoded = BinaryIds<T>::encode(graph.getIds());
+    std::vector<uint64_t> offsets(graph.getOffsets().begin(), graph.getOffsets().end());
+    const std::vector<uint32_t>& targets = graph.getTargets();
+    std::vector<int32_t> weights(graph.getWeights().begin(), graph.getWeights().end());
+    bool weighted = graph.isWeighted();
+
+    BinaryGraphHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, "EGRAPHS", 8);
+    header.version = BinaryGraphHeader::VERSION;
+    header.endianness = BinaryGraphHeader::ENDIANNESS;
+    header.flags = (weighted ? BinaryGraphHeader::WEIGHTED : 0) |
+                   (graph.isDirected() ? BinaryGraphHeader::DIRECTED : 0) |
+                   (graph.isTransposed() ? BinaryGraphHeader::TRANSPOSED : 0);
+    header.id_kind = BinaryIds<T>::KIND;
+    header.id_size = BinaryIds<T>::SIZE;
+    header.vertex_count = graph.size();
+    header.edge_count = targets.size();
+    header.ids_offset = align(sizeof(header));
+    header.ids_bytes = encoded.size();
+    header.offsets_offset = align(header.ids_offset + header.ids_bytes);
+    header.targets_offset = align(header.offsets_offset + offsets.size() * sizeof(uint64_t));
+    uint64_t end = header.targets_offset + targets.size() * sizeof(uint32_t);
+    // Graphs without edges have no weights section, weighted or not
+    if (not weights.empty()) {
+        header.weights_offset = align(end);
+        end = header.weights_offset + weights.size() * sizeof(int32_t);
+    }
+    header.file_size = end;
+    header.ids_checksum = Checksum::of(encoded.data(), encoded.size());
+    header.offsets_checksum = Checksum::of(offsets.data(), offsets.size() * sizeof(uint64_t));
+    header.targets_checksum = Checksum::of(targets.data(), targets.size() * sizeof(uint32_t));
+    header.weights_checksum = not weights.empty() ?
+        Checksum::of(weights.data(), weights.size() * sizeof(int32_t)) : 0;
+    header.header_checksum = headerChecksum(header);
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (out.fail()) return false;
+    uint64_t written = 0;
+    writeSection(out, written, 0, &header, sizeof(header));
+    writeSection(out, written, header.ids_offset, encoded.data(), encoded.size());
+    writeSection(out, written, header.offsets_offset, offsets.data(),
+                 offsets.size() * sizeof(uint64_t));
+    writeSection(out, written, header.targets_offset, targets.data(),
+                 targets.size() * sizeof(uint32_t));
+    if (not weights.empty()) {
+        writeSection(out, written, header.weights_offset, weights.data(),
+                     weights.size() * sizeof(int32_t));
+    }
+    out.close();
+    return not out.fail();
+}
+
+template <typename T>
+bool BinaryGraphView<T>::open(const std::string& path, bool verify) {
+    EASY_GRAPHS_TRACE("BinaryGraphView::open");
+    using namespace binary_graph;
+    close();
+    if (not file.open(path, false) or file.size() < sizeof(BinaryGraphHeader)) {
+        close();
+        return false;
+    }
+    const BinaryGraphHeader* candidate =
+        reinterpret_cast<const BinaryGraphHeader*>(file.data());
+    const BinaryGraphHeader& h = *candidate;
+    uint64_t size = file.size();
+    uint64_t count = h.vertex_count, edges = h.edge_count;
+    bool valid =
+        std::memcmp(h.magic, "EGRAPHS", 8) == 0 and
+        h.version == BinaryGraphHeader::VERSION and
+        h.endianness == BinaryGraphHeader::ENDIANNESS and
+        h.header_checksum == headerChecksum(h) and
+        h.id_kind == BinaryIds<T>::KIND and h.id_size == BinaryIds<T>::SIZE and
+        h.file_size == size and count < (uint64_t(1) << 32) and
+        h.ids_offset % ALIGNMENT == 0 and fits(h.ids_offset, h.ids_bytes, 1, size) and
+        h.offsets_offset % ALIGNMENT == 0 and
+        fits(h.offsets_offset, count + 1, sizeof(uint64_t), size) and
+        h.targets_offset % ALIGNMENT == 0 and
+        fits(h.targets_offset, edges, sizeof(uint32_t), size) and
+        ((h.flags & BinaryGraphHeader::WEIGHTED) == 0 or edges == 0 ?
+            h.weights_offset == 0 :
+            h.weights_offset % ALIGNMENT == 0 and
+            fits(h.weights_offset, edges, sizeof(int32_t), size));
+    if (not valid) {
+        close();
+        return false;
+    }
+    ids = file.data() + h.ids_offset;
+    offsets = reinterpret_cast<const uint64_t*>(file.data() + h.offsets_offset);
+    targets = reinterpret_cast<const uint32_t*>(file.data() + h.targets_offset);
+    weights = h.weights_offset == 0 ? nullptr :
+        reinterpret_cast<const int32_t*>(file.data() + h.weights_offset);
+    if (offsets[0] != 0 or offsets[count] != edges or
+        not BinaryIds<T>::check(ids, h.ids_bytes, count)) {
+        close();
+        return false;
+    }
+    header = candidate;
+    if (verify and not this->verify()) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+template <typename T>
+bool BinaryGraphView<T>::verify() const {
+    if (header == nullptr) return false;
+    uint64_t count = header->vertex_count, edges = header->edge_count;
+    if (Checksum::of(ids, header->ids_bytes) != header->ids_checksum or
+        Checksum::of(offsets, (count + 1) * sizeof(uint64_t)) != header->offsets_checksum or
+        Checksum::of(targets, edges * sizeof(uint32_t)) != header->targets_checksum or
+        (weights != nullptr and
+         Checksum::of(weights, edges * sizeof(int32_t)) != header->weights_checksum)) {
+        return false;
+    }
+    return wellFormed();
+}
+
+template <typename T>
+bool BinaryGraphView<T>::wellFormed() const {
+    if (header == nullptr) return false;
+    uint64_t count = header->vertex_count, edges = header->edge_count;
+    for (uint64_t v = 0; v < count; v++) {
+        if (offsets[v] > offsets[v + 1]) return false;
+    }
+    for (uint64_t e = 0; e < edges; e++) {
+        if (targets[e] >= count) return false;
+    }
+    return true;
+}
+
+template <typename T>
+AdjacencySnapshot<T> BinaryGraphView<T>::toSnapshot() const {
+    EASY_GRAPHS_TRACE("BinaryGraphView::toSnapshot");
+    if (not wellFormed()) {
+        return AdjacencySnapshot<T>();
+    }
+    std::vector<T> id_table(size());
+    for (size_t v = 0; v < id_table.size(); v++) {
+        id_table[v] = getId(v);
+    }
+    return AdjacencySnapshot<T>(isWeighted(), isDirected(), std::move(id_table),
+                                std::vector<size_t>(offsets, offsets + size() + 1),
+                                std::vector<uint32_t>(targets, targets + edgeCount()),
+                                weights == nullptr ? std::vector<int>() :
+                                    std::vector<int>(weights, weights + edgeCount()),
+                                isTransposed());
+}
+
+template <typename T>
+Graph<T> BinaryGraphView<T>::toGraph() const {
+    EASY_GRAPHS_TRACE("BinaryGraphView::toGraph");
+    // Empty when the snapshot is
+    AdjacencySnapshot<T> snapshot = isTransposed() ? toSnapshot().transpose() : toSnapshot();
+    return Graph<T>::fromRows(snapshot.isWeighted(), snapshot.isDirected(),
+                              snapshot.getIds(), snapshot.getOffsets(),
+                              snapshot.getTargets(), snapshot.getWeights());
+}
+
+  // easy_graphs namespace end
+}
+
+#endif // BINARY_GRAPH_H
@@ -0,0 +1,201 @@
+/*
+  Output with a fixed size buffer straight to a file descriptor (a FILE*
+  where there are no descriptors), for writers of big texts like
+  Graph::writeDot: the memory used does not depend on the size of the
+  output and integers are formatted without streams nor locales.
+ */
+
+#ifndef BUFFERED_WRITER_H
+#define BUFFERED_WRITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define EASY_GRAPHS_FILE_DESCRIPTORS 1
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace easy_graphs {
+
+  /*
+    Writes the decimal digits of value at out, which needs 20 characters,
+    and returns how many were written. Two digits per step from a table.
+   */
+  inline size_t formatInteger(char* out, unsigned long long value) {
+    static const char pairs[] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+    char digits[20];
+    char* position = digits + sizeof(digits);
+    while (value >= 100) {
+      unsigned pair = unsigned(value % 100) * 2;
+      value /= 100;
+      *--position = pairs[pair + 1];
+      *--position = pairs[pair];
+    }
+    if (value >= 10) {
+      unsigned pair = unsigned(value) * 2;
+      *--position = pairs[pair + 1];
+      *--position = pairs[pair];
+    } else {
+      *--position = char('0' + value);
+    }
+    size_t length = size_t(digits + sizeof(digits) - position);
+    std::memcpy(out, position, length);
+    return length;
+  }
+
+  inline size_t formatInteger(char* out, long long value) {
+    if (value < 0) {
+      *out = '-';
+      return 1 + formatInteger(out + 1, 0ULL - (unsigned long long)(value));
+    }
+    return formatInteger(out, (unsigned long long)(value));
+  }
+
+  class BufferedWriter {
+  public:
+#ifdef EASY_GRAPHS_FILE_DESCRIPTORS
+    // Writes to an open descriptor, which is not closed by the writer
+    explicit BufferedWriter(int fd, size_t buffer_size = 1 << 16)
+        : buffer(buffer_size < 64 ? 64 : buffer_size), fd(fd) {}
+#endif
+
+    // Creates or truncates the file, check good() afterwards
+    explicit BufferedWriter(const std::string& path, size_t buffer_size = 1 << 16)
+        : buffer(buffer_size < 64 ? 64 : buffer_size) {
+#ifdef EASY_GRAPHS_FILE_DESCRIPTORS
+      fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+      owned = fd >= 0;
+      failed = fd < 0;
+#else
+      file = std::fopen(path.c_str(), "wb");
+      failed = file == nullptr;
+#endif
+    }
+
+    BufferedWriter(const BufferedWriter&) = delete;
+    BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+    ~BufferedWriter() { close(); }
+
+    // False after any error of the system calls
+    bool good() const { return not failed; }
+
+    // Empties the buffer into the file
+    bool flush() {
+      size_t size = used;
+      used = 0;
+      return writeAll(buffer.data(), size);
+    }
+
+    // Flushes and closes the file if the writer opened it
+    bool close() {
+      flush();
+#ifdef EASY_GRAPHS_FILE_DESCRIPTORS
+      if (owned and ::close(fd) != 0) failed = true;
+      owned = false;
+#else
+      if (file != nullptr and std::fclose(file) != 0) failed = true;
+      file = nullptr;
+#endif
+      return not failed;
+    }
+
+    void write(const char* data, size_t size) {
+      if (size > buffer.size() - used) {
+        flush();
+        if (size >= buffer.size()) { // too big to be worth copying
+          writeAll(data, size);
+          return;
+        }
+      }
+      std::memcpy(buffer.data() + used, data, size);
+      used += size;
+    }
+
+    BufferedWriter& operator<<(char c) {
+      if (used == buffer.size()) flush();
+      buffer[used++] = c;
+      return *this;
+    }
+
+    BufferedWriter& operator<<(const char* text) {
+      write(text, std::strlen(text));
+      return *this;
+    }
+
+    BufferedWriter& operator<<(const std::string& text) {
+      write(text.data(), text.size());
+      return *this;
+    }
+
+    // Integers, formatted in place in the buffer
+    template <typename Integer>
+    typename std::enable_if<std::is_integral<Integer>::value and
+                            not std::is_same<Integer, char>::value and
+                            not std::is_same<Integer, bool>::value, BufferedWriter&>::type
+    operator<<(Integer value) {
+      if (buffer.size() - used < 21) flush();
+      if (std::is_signed<Integer>::value) {
+        used += formatInteger(buffer.data() + used, (long long)(value));
+      } else {
+        used += formatInteger(buffer.data() + used, (unsigned long long)(value));
+      }
+      return *this;
+    }
+
+    // Anything else is formatted by its operator<< of std::ostream
+    template <typename Value>
+    typename std::enable_if<not std::is_integral<Value>::value, BufferedWriter&>::type
+    operator<<(const Value& value) {
+      std::ostringstream text;
+      text << value;
+      return *this << text.str();
+    }
+
+  private:
+    bool writeAll(const char* data, size_t size) {
+      if (failed) return false;
+#ifdef EASY_GRAPHS_FILE_DESCRIPTORS
+      while (size > 0) {
+        ssize_t written = ::write(fd, data, size);
+        if (written < 0) {
+          if (errno == EINTR) continue;
+          failed = true;
+          return false;
+        }
+        data += written;
+        size -= size_t(written);
+      }
+#else
+      if (size > 0 and std::fwrite(data, 1, size, file) != size) failed = true;
+#endif
+      return not failed;
+    }
+
+    std::vector<char> buffer;
+    size_t used = 0;
+    bool failed = false;
+#ifdef EASY_GRAPHS_FILE_DESCRIPTORS
+    int fd = -1;
+    bool owned = false;
+#else
+    std::FILE* file = nullptr;
+#endif
+  };
+
+  // easy_graphs namespace end
+}
+
+#endif // BUFFERED_WRITER_H
@@ -0,0 +1,467 @@
+/*
+  Reader of graphs written in the DOT language, enough of it to read back
+  the output of Graph::dotRepr and the usual hand written or exported .gv
+  files. The text is scanned once, statement by statement, and the edges
+  go straight to a GraphBuilder: no syntax tree is kept in memory.
+
+  Supported: strict, graph and digraph headers; node and edge statements
+  with chains (a -> b -> c) and attribute lists; graph, node and edge
+  attribute statements (edge [weight = 2] sets the default weight);
+  subgraphs and clusters, whose statements are flattened into the graph;
+  identifiers, numerals, quoted strings (with escaped quotes, + joining
+  and line continuations) and HTML strings; ports; comments.
+  Not supported: subgraphs as ends of an edge (a -> {b c}).
+ */
+
+#ifndef DOT_READER_H
+#define DOT_READER_H
+
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "../graph_builder.h"
+#include "mapped_file.h"
+#include "parsing.h"
+
+namespace easy_graphs {
+
+/*
+  Reads a DOT graph into graph, which is replaced. The graph is directed
+  for digraph, and weighted when some edge has a weight or a taillabel
+  (the attribute written by dotRepr) that is a number; weight is used
+  before taillabel and edges without them weight the default, 1 unless
+  changed by an edge attribute statement. Vertices are numbered by their
+  first appearance. In strict graphs the repeated edges, which dotRepr
+  writes for both directions of every undirected edge, are added once.
+  Returns false, leaving graph untouched, on a syntax error or an id that
+  IdTraits<T> can not convert.
+  Complexity: O(size of the text + V + E)
+ */
+template <typename T>
+bool readDot(const char* data, size_t size, Graph<T>& graph);
+
+template <typename T>
+bool readDot(const std::string& path, Graph<T>& graph);
+
+/*
+  Same as above into a builder created by the reader, for callers which
+  want a snapshot instead of a graph.
+ */
+template <typename T>
+bool readDot(const char* data, size_t size, GraphBuilder<T>& builder);
+
+// ----------------- IMPLEMENTATION --------------------
+
+namespace dot {
+
+  enum class Token {
+    ID, LEFT_BRACE, RIGHT_BRACE, LEFT_BRACKET, RIGHT_BRACKET, EQUAL,
+    SEPARATOR, COLON, DIRECTED_EDGE, UNDIRECTED_EDGE, END, ERROR
+  };
+
+  /*
+    Splits the text in tokens. The text of an ID is a range of the input
+    when it has nothing to unescape, and a copy in buffer otherwise.
+   */
+  class Lexer {
+   public:
+    Lexer(const char* data, size_t size) : current(data), last(data + size) {}
+
+    Token next() {
+      quoted = false;
+      skipBlanksAndComments();
+      if (current == last) return Token::END;
+      char c = *current;
+      switch (c) {
+        case '{': current++; return Token::LEFT_BRACE;
+        case '}': current++; return Token::RIGHT_BRACE;
+        case '[': current++; return Token::LEFT_BRACKET;
+        case ']': current++; return Token::RIGHT_BRACKET;
+        case '=': current++; return Token::EQUAL;
+        case ';': case ',': current++; return Token::SEPARATOR;
+        case ':': current++; return Token::COLON;
+        case '"': return quotedString();
+        case '<': return htmlString();
+        default: break;
+      }
+      if (c == '-' and current + 1 != last and (current[1] == '>' or current[1] == '-')) {
+        current += 2;
+        return current[-1] == '>' ? Token::DIRECTED_EDGE : Token::UNDIRECTED_EDGE;
+      }
+      if (isIdCharacter(c) or c == '-' or c == '.') {
+        first = current;
+        bool numeral = c == '-' or c == '.' or std::isdigit(static_cast<unsigned char>(c));
+        current++;
+        while (current != last) {
+          c = *current;
+          if (numeral ? (std::isdigit(static_cast<unsigned char>(c)) or c == '.')
+                      : isIdCharacter(c)) {
+            current++;
+          } else {
+            break;
+          }
+        }
+        end = current;
+        return Token::ID;
+      }
+      return Token::ERROR;
+    }
+
+    // Text of the last ID
+    const char* textBegin() const { return first; }
+    const char* textEnd() const { return end; }
+
+    // True if the last ID was quoted (quoted ids are never keywords)
+    bool wasQuoted() const { return quoted; }
+
+    bool is(const char* keyword) const {
+      size_t length = std::strlen(keyword);
+      if (quoted or size_t(end - first) != length) return false;
+      for (size_t i = 0; i < length; i++) {
+        if (std::tolower(static_cast<unsigned char>(first[i])) != keyword[i]) return false;
+      }
+      return true;
+    }
+
+   private:
+    static bool isIdCharacter(char c) {
+      return std::isalnum(static_cast<unsigned char>(c)) or c == '_' or
+             static_cast<unsigned char>(c) >= 128;
+    }
+
+    // Lines starting with # are output of the C preprocessor, ignored
+    void skipBlanksAndComments() {
+      while (current != last) {
+        char c = *current;
+        if (c == '\n') {
+          at_line_start = true;
+          current++;
+        } else if (std::isspace(static_cast<unsigned char>(c))) {
+          current++;
+        } else if ((c == '#' and at_line_start) or
+                   (c == '/' and current + 1 != last and current[1] == '/')) {
+          current = parsing::nextLine(current, last);
+          at_line_start = true;
+        } else if (c == '/' and current + 1 != last and current[1] == '*') {
+          const char* close = current + 2;
+          while (close + 1 < last and not (close[0] == '*' and close[1] == '/')) close++;
+          current = close + 1 < last ? close + 2 : last;
+        } else {
+          break;
+        }
+      }
+      at_line_start = false;
+    }
+
+    // "..." optionally joined with + to more quoted strings
+    Token quotedString() {
+      bool copied = false;
+      for (bool first_piece = true; ; first_piece = false) {
+        const char* start = ++current; // after the opening quote
+        const char* close = start;
+        bool plain = true;
+        while (close != last and *close != '"') {
+          if (*close == '\\' and close + 1 != last) {
+            plain = false;
+            close++;
+          }
+          close++;
+        }
+        if (close == last) return Token::ERROR;
+        if (first_piece and plain) {
+          first = start;
+          end = close;
+        } else {
+          if (not copied) {
+            if (first_piece) {
+              buffer.clear();
+            } else {
+              buffer.assign(first, end);
+            }
+            copied = true;
+          }
+          unescape(start, close);
+        }
+        current = close + 1;
+        // Joined strings: "a" + "b"
+        const char* after = current;
+        while (after != last and std::isspace(static_cast<unsigned char>(*after))) after++;
+        if (after == last or *after != '+') break;
+        after++;
+        while (after != last and std::isspace(static_cast<unsigned char>(*after))) after++;
+        if (after == last or *after != '"') break;
+        current = after;
+      }
+      if (copied) {
+        first = buffer.data();
+        end = buffer.data() + buffer.size();
+      }
+      quoted = true;
+      return Token::ID;
+    }
+
+    // Appends a quoted text to buffer, without \" escapes nor line continuations
+    void unescape(const char* from, const char* to) {
+      for (const char* c = from; c != to; c++) {
+        if (*c == '\\' and c + 1 != to and (c[1] == '"' or c[1] == '\n')) {
+          c++;
+          if (*c == '\n') continue;
+        } else if (*c == '\\' and c + 2 < to and c[1] == '\r' and c[2] == '\n') {
+          c += 2;
+          continue;
+        }
+        buffer.push_back(*c);
+      }
+    }
+
+    // <...> with nested angle brackets, the text between the outer ones
+    Token htmlString() {
+      int depth = 0;
+      const char* start = current + 1;
+      for (; current != last; current++) {
+        if (*current == '<') depth++;
+        if (*current == '>' and --depth == 0) break;
+      }
+      if (current == last) return Token::ERROR;
+      first = start;
+      end = current++;
+      quoted = true;
+      return Token::ID;
+    }
+
+    const char* current;
+    const char* last;
+    const char* first = nullptr;
+    const char* end = nullptr;
+    bool quoted = false;
+    bool at_line_start = true;
+    std::string buffer;
+  };
+
+  // Weight given by an attribute list, kept by the reader between lists
+  struct EdgeAttributes {
+    bool has_weight = false;
+    bool has_taillabel = false;
+    int weight = 1;
+    int taillabel = 1;
+  };
+
+  template <typename T>
+  class Reader {
+   public:
+    Reader(const char* data, size_t size) : lexer(data, size) {}
+
+    bool read() {
+      // Header: [strict] (graph | digraph) [ID] {
+      Token token = lexer.next();
+      if (token == Token::ID and lexer.is("strict")) {
+        strict = true;
+        token = lexer.next();
+      }
+      if (token != Token::ID or not (lexer.is("graph") or lexer.is("digraph"))) {
+        return false;
+      }
+      directed = lexer.is("digraph");
+      builder.reset(new GraphBuilder<T>(true, directed));
+      token = lexer.next();
+      if (token == Token::ID) token = lexer.next();
+      if (token != Token::LEFT_BRACE) return false;
+
+      int depth = 1;
+      token = lexer.next();
+      while (depth > 0) {
+        switch (token) {
+          case Token::RIGHT_BRACE:
+            depth--;
+            token = lexer.next();
+            break;
+          case Token::LEFT_BRACE: // anonymous subgraph
+            depth++;
+            token = lexer.next();
+            break;
+          case Token::SEPARATOR:
+            token = lexer.next();
+            break;
+          case Token::ID:
+            if (not statement(token, depth)) return false;
+            break;
+          default:
+            return false;
+        }
+      }
+      if (token != Token::END) return false;
+      builder->setWeighted(weighted);
+      return true;
+    }
+
+    GraphBuilder<T>& result() { return *builder; }
+
+   private:
+    // Statement starting at an ID, leaves in token the one after it
+    bool statement(Token& token, int& depth) {
+      if (lexer.is("subgraph")) {
+        token = lexer.next();
+        if (token == Token::ID) token = lexer.next();
+        if (token != Token::LEFT_BRACE) return false;
+        depth++;
+        token = lexer.next();
+        return true;
+      }
+      if (lexer.is("graph") or lexer.is("node") or lexer.is("edge")) {
+        bool edge = lexer.is("edge");
+        token = lexer.next();
+        EdgeAttributes attributes;
+        if (not attributeLists(token, attributes)) return false;
+        if (edge) {
+          if (attributes.has_weight) default_weight = attributes.weight;
+          else if (attributes.has_taillabel) default_weight = attributes.taillabel;
+          weighted = weighted or attributes.has_weight or attributes.has_taillabel;
+        }
+        return true;
+      }
+      uint32_t source;
+      if (not vertex(source)) return false;
+      token = lexer.next();
+      if (token == Token::EQUAL) { // graph attribute: ID = ID
+        token = lexer.next();
+        if (token != Token::ID) return false;
+        token = lexer.next();
+        return true;
+      }
+      if (not port(token)) return false;
+      if (token != Token::DIRECTED_EDGE and token != Token::UNDIRECTED_EDGE) {
+        EdgeAttributes ignored; // node statement
+        return attributeLists(token, ignored);
+      }
+      chain.clear();
+      chain.push_back(source);
+      while (token == Token::DIRECTED_EDGE or token == Token::UNDIRECTED_EDGE) {
+        if ((token == Token::DIRECTED_EDGE) != directed) return false;
+        token = lexer.next();
+        uint32_t target;
+        if (token != Token::ID or lexer.is("subgraph") or not vertex(target)) return false;
+        chain.push_back(target);
+        token = lexer.next();
+        if (not port(token)) return false;
+      }
+      EdgeAttributes attributes;
+      if (not attributeLists(token, attributes)) return false;
+      int weight = default_weight;
+      if (attributes.has_weight) {
+        weight = attributes.weight;
+      } else if (attributes.has_taillabel) {
+        weight = attributes.taillabel;
+      }
+      weighted = weighted or attributes.has_weight or attributes.has_taillabel;
+      for (size_t i = 0; i + 1 < chain.size(); i++) {
+        addEdge(chain[i], chain[i + 1], weight);
+      }
+      return true;
+    }
+
+    bool vertex(uint32_t& index) {
+      T id;
+      if (not IdTraits<T>::parse(lexer.textBegin(), lexer.textEnd(), id)) return false;
+      index = builder->addVertex(id);
+      return true;
+    }
+
+    // Skips :port and :port:compass after a node id
+    bool port(Token& token) {
+      for (int parts = 0; token == Token::COLON and parts < 2; parts++) {
+        if (lexer.next() != Token::ID) return false;
+        token = lexer.next();
+      }
+      return true;
+    }
+
+    // [a = b, c = d] [ ... ], reads the weights and ignores the rest
+    bool attributeLists(Token& token, EdgeAttributes& attributes) {
+      while (token == Token::LEFT_BRACKET) {
+        token = lexer.next();
+        while (token != Token::RIGHT_BRACKET) {
+          if (token == Token::SEPARATOR) {
+            token = lexer.next();
+            continue;
+          }
+          if (token != Token::ID) return false;
+          bool is_weight = lexer.is("weight");
+          bool is_taillabel = lexer.is("taillabel");
+          if (lexer.wasQuoted()) {
+            std::string key(lexer.textBegin(), lexer.textEnd());
+            is_weight = key == "weight";
+            is_taillabel = key == "taillabel";
+          }
+          if (lexer.next() != Token::EQUAL or lexer.next() != Token::ID) return false;
+          int value;
+          if (parsing::parseWeight(lexer.textBegin(), lexer.textEnd(), value)) {
+            if (is_weight) {
+              attributes.has_weight = true;
+              attributes.weight = value;
+            } else if (is_taillabel) {
+              attributes.has_taillabel = true;
+              attributes.taillabel = value;
+            }
+          }
+          token = lexer.next();
+        }
+        token = lexer.next();
+      }
+      return true;
+    }
+
+    void addEdge(uint32_t source, uint32_t target, int weight) {
+      if (strict) {
+        uint64_t low = source, high = target;
+        if (not directed and low > high) std::swap(low, high);
+        if (not seen.insert((high << 32) | low).second) return;
+      }
+      builder->addEdgeByIndex(source, target, weight);
+    }
+
+    Lexer lexer;
+    std::unique_ptr<GraphBuilder<T>> builder;
+    bool strict = false;
+    bool directed = false;
+    bool weighted = false;
+    int default_weight = 1;
+    std::vector<uint32_t> chain;
+    std::unordered_set<uint64_t> seen; // edges of strict graphs
+  };
+
+} // dot namespace end
+
+template <typename T>
+bool readDot(const char* data, size_t size, GraphBuilder<T>& builder) {
+    EASY_GRAPHS_TRACE("readDot");
+    dot::Reader<T> reader(data, size);
+    if (not reader.read()) return false;
+    builder = std::move(reader.result());
+    return true;
+}
+
+template <typename T>
+bool readDot(const char* data, size_t size, Graph<T>& graph) {
+    dot::Reader<T> reader(data, size);
+    if (not reader.read()) return false;
+    graph = reader.result().build();
+    return true;
+}
+
+template <typename T>
+bool readDot(const std::string& path, Graph<T>& graph) {
+    MappedFile file(path);
+    if (not file.isOpen()) return false;
+    return readDot(file.data(), file.size(), graph);
+}
+
+} // easy_graphs namespace end
+
+#endif // DOT_READER_H
@@ -0,0 +1,271 @@
+/*
+  Loaders of graphs stored as text: whitespace separated edge lists (SNAP,
+  TSV) and Matrix Market coordinate files. The file is memory mapped and
+  parsed in windows, each window split by lines between threads, and the
+  edges go to a GraphBuilder, from which the Graph or the AdjacencySnapshot
+  is built.
+ */
+
+#ifndef EDGE_LIST_H
+#define EDGE_LIST_H
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "../graph_builder.h"
+#include "../parallel.h"
+#include "mapped_file.h"
+#include "parsing.h"
+
+namespace easy_graphs {
+
+/*
+  Loads an edge list: one edge per line, "source target" or
+  "source target weight"; empty lines and lines starting with # or % are
+  comments. The ids are converted by IdTraits<T> and numbered by the hash
+  index of the builder in order of first appearance, a missing weight is 1.
+  The extra memory is bounded by window_bytes, not by the size of the file.
+  On a malformed line it returns false, the builder keeps the edges of the
+  windows before the one with the error.
+  Complexity: O(size of the file), the parsing split in num_threads threads
+ */
+template <typename T>
+bool loadEdgeList(const std::string& path, GraphBuilder<T>& builder,
+                  unsigned num_threads = 0, size_t window_bytes = 64 << 20);
+
+// Same as above from a buffer already in memory
+template <typename T>
+bool loadEdgeList(const char* data, size_t size, GraphBuilder<T>& builder,
+                  unsigned num_threads = 0, size_t window_bytes = 64 << 20);
+
+/*
+  Loads a Matrix Market coordinate file (integer, real or pattern values,
+  general or symmetric). Every row and column index 1 .. n is a vertex with
+  id IdTraits<T>::fromInteger(index), added in order, so the vertex of
+  index i is i - 1 in the builder. Real values are rounded, pattern
+  entries weight 1. Off diagonal entries of symmetric matrices are added
+  in both directions when the builder is directed.
+  The builder must be empty, the indices of the file are used directly.
+  Complexity: O(size of the file), parsed in num_threads threads
+ */
+template <typename T>
+bool loadMatrixMarket(const std::string& path, GraphBuilder<T>& builder,
+                      unsigned num_threads = 0, size_t window_bytes = 64 << 20);
+
+template <typename T>
+bool loadMatrixMarket(const char* data, size_t size, GraphBuilder<T>& builder,
+                      unsigned num_threads = 0, size_t window_bytes = 64 << 20);
+
+// ----------------- IMPLEMENTATION --------------------
+
+namespace parsing {
+
+  // Edges parsed by one thread from its slice of a window
+  template <typename Id>
+  struct ParsedEdges {
+    std::vector<Id> ends; // source and target of every edge
+    std::vector<int> weights;
+    void clear() {
+      ends.clear();
+      weights.clear();
+    }
+  };
+
+  inline bool isComment(char c) { return c == '#' or c == '%'; }
+
+  /*
+    Calls parse(thread, first, last) on the slices of every window of
+    [data, data + size) and then merge(thread) in order of the slices.
+    Stops at the first window with a failed slice.
+   */
+  template <typename Parse, typename Merge>
+  bool parseWindows(const char* data, size_t size, unsigned num_threads,
+                    size_t window_bytes, Parse parse, Merge merge) {
+    unsigned threads = resolveThreadCount(num_threads);
+    window_bytes = std::max<size_t>(window_bytes, 1 << 12);
+    const char* last = data + size;
+    for (const char* first = data; first < last; ) {
+      const char* end = first + std::min(window_bytes, size_t(last - first));
+      if (end < last) end = nextLine(end - 1, last);
+      std::vector<const char*> bounds = splitLines(first, end, threads);
+      std::vector<char> ok(bounds.size() - 1, 1);
+      parallelFor(0, bounds.size() - 1, threads, [&](unsigned, size_t lo, size_t hi) {
+        for (size_t part = lo; part < hi; part++) {
+          ok[part] = parse(unsigned(part), bounds[part], bounds[part + 1]);
+        }
+      }, 1);
+      for (size_t part = 0; part + 1 < bounds.size(); part++) {
+        if (not ok[part]) return false;
+      }
+      for (size_t part = 0; part + 1 < bounds.size(); part++) {
+        merge(unsigned(part));
+      }
+      first = end;
+    }
+    return true;
+  }
+
+} // parsing namespace end
+
+template <typename T>
+bool loadEdgeList(const std::string& path, GraphBuilder<T>& builder,
+                  unsigned num_threads, size_t window_bytes) {
+    MappedFile file(path);
+    if (not file.isOpen()) return false;
+    return loadEdgeList(file.data(), file.size(), builder, num_threads, window_bytes);
+}
+
+template <typename T>
+bool loadEdgeList(const char* data, size_t size, GraphBuilder<T>& builder,
+                  unsigned num_threads, size_t window_bytes) {
+    EASY_GRAPHS_TRACE("loadEdgeList");
+    using namespace parsing;
+    std::vector<ParsedEdges<T>> parsed(resolveThreadCount(num_threads));
+    auto parse = [&](unsigned part, const char* first, const char* last) {
+        ParsedEdges<T>& out = parsed[part];
+        out.clear();
+        T source, target;
+        for (const char* line = first; line < last; line = nextLine(line, last)) {
+            const char* token = line;
+            if (not skipBlanks(token, last) or isComment(*token)) continue;
+            const char* token_end = tokenEnd(token, last);
+            if (not IdTraits<T>::parse(token, token_end, source)) return false;
+            token = token_end;
+            if (not skipBlanks(token, last)) return false;
+            token_end = tokenEnd(token, last);
+            if (not IdTraits<T>::parse(token, token_end, target)) return false;
+            int weight = 1;
+            token = token_end;
+            if (skipBlanks(token, last)) {
+                token_end = tokenEnd(token, last);
+                if (not parseWeight(token, token_end, weight)) return false;
+            }
+            out.ends.push_back(source);
+            out.ends.push_back(target);
+            out.weights.push_back(weight);
+        }
+        return true;
+    };
+    // Numbering the vertices needs the order of the file, it is sequential
+    auto merge = [&](unsigned part) {
+        const ParsedEdges<T>& in = parsed[part];
+        for (size_t e = 0; e < in.weights.size(); e++) {
+            builder.addEdge(in.ends[2 * e], in.ends[2 * e + 1], in.weights[e]);
+        }
+    };
+    return parseWindows(data, size, num_threads, window_bytes, parse, merge);
+}
+
+template <typename T>
+bool loadMatrixMarket(const std::string& path, GraphBuilder<T>& builder,
+                      unsigned num_threads, size_t window_bytes) {
+    MappedFile file(path);
+    if (not file.isOpen()) return false;
+    return loadMatrixMarket(file.data(), file.size(), builder, num_threads, window_bytes);
+}
+
+template <typename T>
+bool loadMatrixMarket(const char* data, size_t size, GraphBuilder<T>& builder,
+                      unsigned num_threads, size_t window_bytes) {
+    EASY_GRAPHS_TRACE("loadMatrixMarket");
+    using namespace parsing;
+    if (builder.vertexCount() != 0) return false;
+    const char* last = data + size;
+    // Banner: %%MatrixMarket matrix coordinate <field> <symmetry>
+    const char* line = data;
+    const char* line_end = nextLine(line, last);
+    std::vector<std::string> banner;
+    for (const char* token = line; skipBlanks(token, line_end); ) {
+        const char* token_end = tokenEnd(token, line_end);
+        std::string word(token, token_end);
+        for (char& c : word) {
+            c = char(std::tolower(static_cast<unsigned char>(c)));
+        }
+        banner.push_back(word);
+        token = token_end;
+    }
+    if (banner.size() < 5 or banner[0] != "%%matrixmarket" or
+        banner[1] != "matrix" or banner[2] != "coordinate" or
+        banner[3] == "complex") {
+        return false;
+    }
+    bool pattern = banner[3] == "pattern";
+    bool symmetric = banner[4] != "general";
+    bool skew = banner[4] == "skew-symmetric";
+    // Size line: rows columns entries, after the comments
+    long long dimensions[3];
+    for (line = line_end; line < last; line = nextLine(line, last)) {
+        const char* token = line;
+        if (skipBlanks(token, last) and not isComment(*token)) break;
+    }
+    const char* token = line;
+    for (long long& dimension : dimensions) {
+        if (not skipBlanks(token, last)) return false;
+        const char* token_end = tokenEnd(token, last);
+        if (not parseInteger(token, token_end, dimension) or dimension < 0) return false;
+        token = token_end;
+    }
+    long long size_n = std::max(dimensions[0], dimensions[1]);
+    builder.reserve(size_t(size_n), size_t(dimensions[2]) * (symmetric ? 2 : 1));
+    for (long long i = 1; i <= size_n; i++) {
+        builder.addVertex(IdTraits<T>::fromInteger(i));
+    }
+    bool mirror = symmetric and builder.isDirected();
+
+    struct Part {
+        std::vector<uint32_t> sources, targets;
+        std::vector<int> weights;
+    };
+    std::vector<Part> parts(resolveThreadCount(num_threads));
+    auto parse = [&](unsigned index, const char* first, const char* end) {
+        Part& out = parts[index];
+        out.sources.clear();
+        out.targets.clear();
+        out.weights.clear();
+        for (const char* row = first; row < end; row = nextLine(row, end)) {
+            const char* token = row;
+            if (not skipBlanks(token, end) or isComment(*token)) continue;
+            long long ends[2];
+            for (long long& value : ends) {
+                if (not skipBlanks(token, end)) return false;
+                const char* token_end = tokenEnd(token, end);
+                if (not parseInteger(token, token_end, value) or
+                    value < 1 or value > size_n) {
+                    return false;
+                }
+                token = token_end;
+            }
+            int weight = 1;
+            if (not pattern) {
+                if (not skipBlanks(token, end)) return false;
+                if (not parseWeight(token, tokenEnd(token, end), weight)) return false;
+            }
+            uint32_t source = uint32_t(ends[0] - 1);
+            uint32_t target = uint32_t(ends[1] - 1);
+            out.sources.push_back(source);
+            out.targets.push_back(target);
+            out.weights.push_back(weight);
+            if (mirror and source != target) {
+                out.sources.push_back(target);
+                out.targets.push_back(source);
+                out.weights.push_back(skew ? -weight : weight);
+            }
+        }
+        return true;
+    };
+    auto merge = [&](unsigned index) {
+        builder.appendEdges(parts[index].sources, parts[index].targets, parts[index].weights);
+    };
+    const char* entries = nextLine(line, last);
+    return parseWindows(entries, size_t(last - entries), num_threads, window_bytes,
+                        parse, merge);
+}
+
+} // easy_graphs namespace end
+
+#endif // EDGE_LIST_H
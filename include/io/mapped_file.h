@@ -0,0 +1,122 @@
+/*
+  Read-only view of a whole file, memory mapped where the system allows it
+  (POSIX mmap) and read into memory otherwise. Used by the loaders of the
+  io folder, which parse the bytes in place.
+ */
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define EASY_GRAPHS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace easy_graphs {
+
+  class MappedFile {
+  public:
+    MappedFile() {}
+
+    explicit MappedFile(const std::string& path, bool sequential = true) {
+      open(path, sequential);
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other)
+        : bytes(other.bytes), length(other.length), mapped(other.mapped),
+          opened(other.opened), buffer(std::move(other.buffer)) {
+      other.bytes = nullptr;
+      other.length = 0;
+      other.mapped = other.opened = false;
+    }
+
+    ~MappedFile() { close(); }
+
+    /*
+      Maps the file, false if it can not be opened. The pages are shared
+      with every other process mapping the same file. sequential asks the
+      system for a bigger read ahead, for files parsed from start to end.
+     */
+    bool open(const std::string& path, bool sequential = true) {
+      close();
+#ifdef EASY_GRAPHS_MMAP
+      int fd = ::open(path.c_str(), O_RDONLY);
+      if (fd < 0) return false;
+      struct stat info;
+      if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        return false;
+      }
+      length = size_t(info.st_size);
+      if (length > 0) {
+        void* address = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+        if (address == MAP_FAILED) {
+          ::close(fd);
+          length = 0;
+          return false;
+        }
+        if (sequential) {
+          madvise(address, length, MADV_SEQUENTIAL);
+        }
+        bytes = static_cast<const char*>(address);
+        mapped = true;
+      }
+      ::close(fd); // the mapping keeps its own reference
+      opened = true;
+      return true;
+#else
+      (void)sequential;
+      std::ifstream file(path, std::ios::binary | std::ios::ate);
+      if (file.fail()) return false;
+      buffer.resize(size_t(file.tellg()));
+      file.seekg(0);
+      file.read(buffer.data(), buffer.size());
+      if (file.fail() and not buffer.empty()) return false;
+      bytes = buffer.data();
+      length = buffer.size();
+      opened = true;
+      return true;
+#endif
+    }
+
+    void close() {
+#ifdef EASY_GRAPHS_MMAP
+      if (mapped) {
+        munmap(const_cast<char*>(bytes), length);
+      }
+#endif
+      std::vector<char>().swap(buffer);
+      bytes = nullptr;
+      length = 0;
+      mapped = opened = false;
+    }
+
+    bool isOpen() const { return opened; }
+
+    const char* data() const { return bytes; }
+
+    size_t size() const { return length; }
+
+  private:
+    const char* bytes = nullptr;
+    size_t length = 0;
+    bool mapped = false;
+    bool opened = false;
+    std::vector<char> buffer; // contents when the file is not mapped
+  };
+
+  // easy_graphs namespace end
+}
+
+#endif // MAPPED_FILE_H
@@ -0,0 +1,137 @@
+/*
+  Small helpers shared by the text loaders: in place tokenizing of lines,
+  integer and number parsing without locales nor null terminated strings,
+  and the conversion of tokens to vertex ids (IdTraits).
+ */
+
+#ifndef PARSING_H
+#define PARSING_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace easy_graphs {
+
+namespace parsing {
+
+  inline bool isBlank(char c) {
+    return c == ' ' or c == '\t' or c == '\r' or c == '\v' or c == '\f';
+  }
+
+  // Moves first to the next token of the line, false at the end of the line
+  inline bool skipBlanks(const char*& first, const char* last) {
+    while (first != last and isBlank(*first)) first++;
+    return first != last and *first != '\n';
+  }
+
+  // End of the token starting at first
+  inline const char* tokenEnd(const char* first, const char* last) {
+    while (first != last and not isBlank(*first) and *first != '\n') first++;
+    return first;
+  }
+
+  // Position after the end of the line of first (or last)
+  inline const char* nextLine(const char* first, const char* last) {
+    const char* newline = static_cast<const char*>(
+        std::memchr(first, '\n', size_t(last - first)));
+    return newline == nullptr ? last : newline + 1;
+  }
+
+  /*
+    Decimal integer with optional sign, the whole token must be digits.
+    Complexity: O(length of the token)
+   */
+  inline bool parseInteger(const char* first, const char* last, long long& value) {
+    bool negative = false;
+    if (first != last and (*first == '-' or *first == '+')) {
+      negative = *first == '-';
+      first++;
+    }
+    if (first == last) return false;
+    unsigned long long result = 0;
+    for (; first != last; first++) {
+      unsigned digit = unsigned(*first) - unsigned('0');
+      if (digit > 9) return false;
+      result = result * 10 + digit;
+    }
+    value = negative ? -(long long)(result) : (long long)(result);
+    return true;
+  }
+
+  /*
+    Weight of an edge: an integer, or a real number rounded to the nearest
+    integer (Matrix Market real values, 1.5e+00 and the like)
+   */
+  inline bool parseWeight(const char* first, const char* last, int& weight) {
+    long long integer;
+    if (parseInteger(first, last, integer)) {
+      weight = int(integer);
+      return true;
+    }
+    char copy[64];
+    size_t length = size_t(last - first);
+    if (length == 0 or length >= sizeof(copy)) return false;
+    std::memcpy(copy, first, length);
+    copy[length] = '\0';
+    char* end;
+    double real = std::strtod(copy, &end);
+    if (end != copy + length) return false;
+    weight = int(std::lround(real));
+    return true;
+  }
+
+  /*
+    Splits [first, last) into at most parts slices which start at the
+    beginning of a line, returns the parts + 1 bounds.
+   */
+  inline std::vector<const char*> splitLines(const char* first, const char* last,
+                                             size_t parts) {
+    std::vector<const char*> bounds(1, first);
+    size_t length = size_t(last - first);
+    for (size_t p = 1; p < parts; p++) {
+      const char* cut = first + length * p / parts;
+      if (cut < bounds.back()) cut = bounds.back();
+      bounds.push_back(cut == first ? first : nextLine(cut - 1, last));
+    }
+    bounds.push_back(last);
+    return bounds;
+  }
+
+} // parsing namespace end
+
+/*
+  Conversion of tokens and integers to vertex ids, defined for integral
+  types and std::string. Specialize it to load graphs of other id types.
+ */
+template <typename T, typename Enable = void>
+struct IdTraits;
+
+template <typename T>
+struct IdTraits<T, typename std::enable_if<std::is_integral<T>::value>::type> {
+  static bool parse(const char* first, const char* last, T& id) {
+    long long value;
+    if (not parsing::parseInteger(first, last, value)) return false;
+    id = T(value);
+    return true;
+  }
+  static T fromInteger(long long value) { return T(value); }
+};
+
+template <>
+struct IdTraits<std::string> {
+  static bool parse(const char* first, const char* last, std::string& id) {
+    id.assign(first, last);
+    return true;
+  }
+  static std::string fromInteger(long long value) { return std::to_string(value); }
+};
+
+} // easy_graphs namespace end
+
+#endif // PARSING_H
@@ -0,0 +1,156 @@
+/*
+  SVG drawing of a graph over a FixedLayout (see force_layout.h), written
+  element by element to a std::ostream or a BufferedWriter, so no
+  graphviz process nor a copy of the whole text is needed.
+ */
+
+#ifndef SVG_WRITER_H
+#define SVG_WRITER_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../adjacency_snapshot.h"
+#include "../graph.h"
+#include "../layout.h"
+
+namespace easy_graphs {
+
+  // Sizes in points and colours of the drawing
+  struct SvgStyle {
+    double node_radius = 14;
+    double font_size = 11;
+    double margin = 20;
+    std::string node_fill = "lightgrey";
+    std::string stroke = "black";
+    bool labels = true; // ids in the nodes and weights on the edges
+  };
+
+  namespace svg {
+
+    // Coordinate with two decimals, without streams
+    class Number {
+    public:
+      explicit Number(double value) { std::snprintf(text, sizeof(text), "%.2f", value); }
+
+      const char* str() const { return text; }
+
+    private:
+      char text[32];
+    };
+
+    // Text with the XML special characters escaped
+    template <typename Sink>
+    void writeEscaped(Sink& out, const std::string& text) {
+      for (char c : text) {
+        switch (c) {
+          case '<': out << "&lt;"; break;
+          case '>': out << "&gt;"; break;
+          case '&': out << "&amp;"; break;
+          case '"': out << "&quot;"; break;
+          default: out << c;
+        }
+      }
+    }
+
+  } // svg namespace end
+
+  /*
+    Writes the graph with every vertex at its position in the layout (found
+    by its dotRepr name, vertices missing in the layout are not drawn).
+    The y axis is flipped, as the layouts have the origin at the bottom.
+    Edges of directed graphs end with an arrow.
+    Complexity: O(V + E)
+   */
+  template <typename T, typename Sink>
+  void writeSvg(Sink& out, const AdjacencySnapshot<T>& graph, const FixedLayout& layout,
+                const SvgStyle& style = SvgStyle()) {
+    size_t size = graph.size();
+    std::vector<long> node(size);
+    std::vector<std::string> names(size);
+    for (size_t v = 0; v < size; v++) {
+      std::ostringstream name;
+      name << graph.getId(v);
+      names[v] = name.str();
+      node[v] = layout.indexOf(names[v]);
+    }
+    double border = style.margin + style.node_radius;
+    double width = layout.getWidth() + 2 * border;
+    double height = layout.getHeight() + 2 * border;
+    auto x = [&](size_t v) { return layout.getX(node[v]) + border; };
+    auto y = [&](size_t v) { return height - border - layout.getY(node[v]); };
+
+    out << "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"" << svg::Number(width).str()
+        << "\" height=\"" << svg::Number(height).str() << "\" viewBox=\"0 0 "
+        << svg::Number(width).str() << ' ' << svg::Number(height).str() << "\">\n";
+    if (graph.isDirected()) {
+      out << "<defs><marker id=\"arrow\" viewBox=\"0 0 10 10\" refX=\"10\" refY=\"5\" "
+             "markerWidth=\"8\" markerHeight=\"8\" orient=\"auto\"><path d=\"M0,0 L10,5 L0,10 z\" "
+             "fill=\"" << style.stroke << "\"/></marker></defs>\n";
+    }
+    out << "<g stroke=\"" << style.stroke << "\" fill=\"none\">\n";
+    bool transposed = graph.isTransposed();
+    for (size_t v = 0; v < size; v++) {
+      for (size_t e = graph.rowBegin(v); e < graph.rowEnd(v); e++) {
+        size_t source = transposed ? graph.target(e) : v;
+        size_t target = transposed ? v : graph.target(e);
+        // undirected edges are in both rows, self loops are not drawn
+        if (source == target or node[source] < 0 or node[target] < 0 or
+            (not graph.isDirected() and source > target)) {
+          continue;
+        }
+        double x1 = x(source), y1 = y(source), x2 = x(target), y2 = y(target);
+        if (graph.isDirected()) { // the arrow ends on the border of the circle
+          double dx = x2 - x1, dy = y2 - y1;
+          double length = std::sqrt(dx * dx + dy * dy);
+          if (length > style.node_radius) {
+            x2 -= dx * style.node_radius / length;
+            y2 -= dy * style.node_radius / length;
+          }
+        }
+        out << "<line x1=\"" << svg::Number(x1).str() << "\" y1=\"" << svg::Number(y1).str()
+            << "\" x2=\"" << svg::Number(x2).str() << "\" y2=\"" << svg::Number(y2).str() << '"';
+        if (graph.isDirected()) {
+          out << " marker-end=\"url(#arrow)\"";
+        }
+        out << "/>\n";
+        if (style.labels and graph.isWeighted()) {
+          out << "<text x=\"" << svg::Number((x1 + x2) / 2).str() << "\" y=\""
+              << svg::Number((y1 + y2) / 2).str()
+              << "\" font-size=\"" << style.font_size << "\" stroke=\"none\" fill=\""
+              << style.stroke << "\">" << graph.weight(e) << "</text>\n";
+        }
+      }
+    }
+    out << "</g>\n<g stroke=\"" << style.stroke << "\" fill=\"" << style.node_fill
+        << "\" font-size=\"" << style.font_size << "\" text-anchor=\"middle\">\n";
+    for (size_t v = 0; v < size; v++) {
+      if (node[v] < 0) continue;
+      out << "<circle cx=\"" << svg::Number(x(v)).str() << "\" cy=\"" << svg::Number(y(v)).str()
+          << "\" r=\"" << svg::Number(style.node_radius).str() << "\"/>\n";
+      if (style.labels) {
+        out << "<text x=\"" << svg::Number(x(v)).str() << "\" y=\""
+            << svg::Number(y(v) + style.font_size / 3).str()
+            << "\" stroke=\"none\" fill=\"" << style.stroke << "\">";
+        svg::writeEscaped(out, names[v]);
+        out << "</text>\n";
+      }
+    }
+    out << "</g>\n</svg>\n";
+  }
+
+  template <typename T, typename Sink>
+  void writeSvg(Sink& out, const Graph<T>& graph, const FixedLayout& layout,
+                const SvgStyle& style = SvgStyle()) {
+    writeSvg(out, AdjacencySnapshot<T>(graph), layout, style);
+  }
+
+  // easy_graphs namespace end
+}
+
+#endif // SVG_WRITER_H
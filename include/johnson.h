@@ -0,0 +1,90 @@
+#ifndef JOHNSON_H
+#define JOHNSON_H
+
+#include <vector>
+
+#include "graph.h"
+
+namespace easy_graphs {
+
+/*
+  Johnson reweighting of a graph with negative weights.
+  A potential h(v) is computed for every vertex with one Bellman-Ford run,
+  then every edge (u, v) gets the weight w + h(u) - h(v) which is never
+  negative, so the reweighted graph can be queried many times with dijkstra.
+  The distances given back by dijkstra are translated to the original weights.
+ */
+template<class T>
+class JohnsonGraph {
+ public:
+  /*
+    Computes the potentials and builds the reweighted graph.
+    The graph is only used during the construction.
+    Complexity: O(V * E) in the worst case for the potentials plus O(V + E)
+                to build the reweighted graph
+   */
+  explicit JohnsonGraph(Graph<T>& graph);
+
+  // If true the graph has a negative cycle and there is nothing to query
+  bool hasNegativeCycle() const { return negative_cycle; }
+
+  // Graph with the same vertices and edges but non negative weights
+  const Graph<T>& getReweighted() const { return reweighted; }
+
+  /*
+    Shortest path between two vertices in terms of the original weights.
+    If there is no path, some of the vertices does not exist or the graph
+    has a negative cycle the path is empty and distance is INT32_MAX.
+    Complexity: The one of Graph::dijkstra(source_id, target_id, distance)
+   */
+  List<T> dijkstra(const T& source_id, const T& target_id, int& distance);
+
+ private:
+  Graph<T> reweighted;
+  std::vector<int> potentials; // indexed by the vertex index
+  bool negative_cycle = false;
+};
+
+// ----------------- IMPLEMENTATION --------------------
+
+template <typename T>
+JohnsonGraph<T>::JohnsonGraph(Graph<T>& graph)
+    : reweighted(graph.weighted, graph.directed) {
+    // Bellman-Ford from a virtual vertex joined to every vertex with
+    // weight 0, which is the same as starting with every vertex at 0
+    graph.resetVerticesFields();
+    List<Vertex<T>*> queue;
+    for (Vertex<T>& vertex : graph.vertices) {
+        queue.append(&vertex);
+    }
+    negative_cycle = not graph.bellmanFord(queue);
+    if (not negative_cycle) {
+        for (const Vertex<T>* vertex : graph.vertexTable()) {
+            potentials.push_back(vertex->getDistance());
+        }
+        reweighted = graph.reweightedCopy([this](size_t i, size_t j, int weight) {
+            return weight + potentials[i] - potentials[j];
+        });
+    }
+    graph.resetVerticesFields();
+}
+
+template <typename T>
+List<T> JohnsonGraph<T>::dijkstra(const T& source_id, const T& target_id,
+                                  int& distance) {
+    distance = INT32_MAX;
+    if (negative_cycle) return {};
+    long source = reweighted.indexOf(source_id);
+    long target = reweighted.indexOf(target_id);
+    if (source < 0 or target < 0) return {};
+    int reweighted_distance = 0;
+    List<T> path = reweighted.dijkstra(source_id, target_id, reweighted_distance);
+    if (reweighted_distance >= 0) {
+        distance = reweighted_distance - potentials[source] + potentials[target];
+    }
+    return path;
+}
+
+} // easy_graphs namespace end
+
+#endif // JOHNSON_H
@@ -0,0 +1,175 @@
+#ifndef KCORE_H
+#define KCORE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "adjacency_snapshot.h"
+#include "parallel.h"
+
+namespace easy_graphs {
+
+/*
+  Core number of every vertex, indexed like the snapshot: the largest k
+  such that the vertex belongs to the k-core, the maximal subgraph where
+  every vertex has at least k neighbours.
+  The graph is taken as simple and undirected (see simplified()).
+  Bucket based peeling of Batagelj and Zaversnik.
+  Complexity: O(V + E)
+ */
+template <typename T>
+std::vector<uint32_t> coreNumbers(const AdjacencySnapshot<T>& graph);
+
+/*
+  Same result as coreNumbers, peeling level by level: every vertex of
+  degree k at level k is removed at the same time and the degrees of its
+  neighbours are decreased by num_threads threads (0 = hardware concurrency).
+  Complexity: O(V * max core + E) work, the scan of each level is parallel
+ */
+template <typename T>
+std::vector<uint32_t> parallelCoreNumbers(const AdjacencySnapshot<T>& graph,
+                                          unsigned num_threads = 0);
+
+template <typename T>
+std::vector<uint32_t> coreNumbers(const Graph<T>& graph) {
+  return coreNumbers(AdjacencySnapshot<T>(graph));
+}
+
+template <typename T>
+std::vector<uint32_t> parallelCoreNumbers(const Graph<T>& graph,
+                                          unsigned num_threads = 0) {
+  return parallelCoreNumbers(AdjacencySnapshot<T>(graph), num_threads);
+}
+
+/*
+  The k-core of a graph as a new graph, given the core numbers of its
+  vertices. Complexity: O(V + E)
+ */
+template <typename T>
+Graph<T> kCore(const Graph<T>& graph, const std::vector<uint32_t>& cores,
+               uint32_t k) {
+  std::vector<bool> keep(cores.size());
+  for (size_t v = 0; v < cores.size(); v++) {
+    keep[v] = cores[v] >= k;
+  }
+  return graph.inducedSubgraph(keep);
+}
+
+template <typename T>
+Graph<T> kCore(const Graph<T>& graph, uint32_t k) {
+  return kCore(graph, coreNumbers(graph), k);
+}
+
+// ----------------- IMPLEMENTATION --------------------
+
+template <typename T>
+std::vector<uint32_t> coreNumbers(const AdjacencySnapshot<T>& snapshot) {
+    AdjacencySnapshot<T> graph = snapshot.simplified();
+    size_t size = graph.size();
+    std::vector<uint32_t> core(size);
+    size_t max_degree = 0;
+    for (size_t v = 0; v < size; v++) {
+        core[v] = uint32_t(graph.degree(v));
+        max_degree = std::max<size_t>(max_degree, core[v]);
+    }
+    // Vertices sorted by current degree, bin[d] is where degree d starts
+    std::vector<size_t> bin(max_degree + 2, 0);
+    for (size_t v = 0; v < size; v++) {
+        bin[core[v] + 1]++;
+    }
+    for (size_t d = 0; d <= max_degree; d++) {
+        bin[d + 1] += bin[d];
+    }
+    std::vector<uint32_t> sorted(size);
+    std::vector<size_t> position(size);
+    std::vector<size_t> next(bin.begin(), bin.end() - 1);
+    for (size_t v = 0; v < size; v++) {
+        position[v] = next[core[v]]++;
+        sorted[position[v]] = uint32_t(v);
+    }
+    for (size_t i = 0; i < size; i++) {
+        uint32_t v = sorted[i];
+        for (size_t e = graph.rowBegin(v); e < graph.rowEnd(v); e++) {
+            uint32_t u = graph.target(e);
+            if (core[u] > core[v]) {
+                // u moves to the front of its bin, then out of it
+                uint32_t d = core[u];
+                size_t first = std::max(bin[d], i + 1);
+                uint32_t w = sorted[first];
+                if (u != w) {
+                    std::swap(sorted[position[u]], sorted[first]);
+                    std::swap(position[u], position[w]);
+                }
+                bin[d] = first + 1;
+                core[u]--;
+            }
+        }
+    }
+    return core;
+}
+
+template <typename T>
+std::vector<uint32_t> parallelCoreNumbers(const AdjacencySnapshot<T>& snapshot,
+                                          unsigned num_threads) {
+    AdjacencySnapshot<T> graph = snapshot.simplified();
+    size_t size = graph.size();
+    unsigned threads = resolveThreadCount(num_threads);
+    std::vector<std::atomic<uint32_t>> degree(size);
+    std::vector<std::atomic<bool>> removed(size);
+    std::vector<uint32_t> core(size, 0);
+    for (size_t v = 0; v < size; v++) {
+        degree[v].store(uint32_t(graph.degree(v)), std::memory_order_relaxed);
+        removed[v].store(false, std::memory_order_relaxed);
+    }
+    std::vector<std::vector<uint32_t>> local(threads);
+    std::vector<uint32_t> frontier;
+    size_t done = 0;
+    for (uint32_t k = 0; done < size; k++) {
+        // Every vertex left with degree <= k has core k
+        parallelFor(0, size, threads, [&](unsigned thread, size_t lo, size_t hi) {
+            for (size_t v = lo; v < hi; v++) {
+                if (not removed[v].load(std::memory_order_relaxed) and
+                    degree[v].load(std::memory_order_relaxed) <= k) {
+                    removed[v].store(true, std::memory_order_relaxed);
+                    local[thread].push_back(uint32_t(v));
+                }
+            }
+        }, 1 << 14);
+        for (std::vector<uint32_t>& part : local) {
+            frontier.insert(frontier.end(), part.begin(), part.end());
+            part.clear();
+        }
+        while (not frontier.empty()) {
+            done += frontier.size();
+            parallelFor(0, frontier.size(), threads,
+                        [&](unsigned thread, size_t lo, size_t hi) {
+                for (size_t i = lo; i < hi; i++) {
+                    uint32_t v = frontier[i];
+                    core[v] = k;
+                    for (size_t e = graph.rowBegin(v); e < graph.rowEnd(v); e++) {
+                        uint32_t u = graph.target(e);
+                        if (removed[u].load(std::memory_order_relaxed)) continue;
+                        // Only the decrement reaching k adds u to the level
+                        if (degree[u].fetch_sub(1, std::memory_order_relaxed) == k + 1) {
+                            removed[u].store(true, std::memory_order_relaxed);
+                            local[thread].push_back(u);
+                        }
+                    }
+                }
+            }, 256);
+            frontier.clear();
+            for (std::vector<uint32_t>& part : local) {
+                frontier.insert(frontier.end(), part.begin(), part.end());
+                part.clear();
+            }
+        }
+    }
+    return core;
+}
+
+} // easy_graphs namespace end
+
+#endif // KCORE_H
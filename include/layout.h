@@ -0,0 +1,139 @@
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace easy_graphs {
+
+/*
+  Positions of the nodes of a drawing, in points, found by their DOT names
+  (the ids as dotRepr writes them). Computed once for the whole graph, by
+  graphviz (dot_extension::computeLayout) or in process, and then used to
+  pin every frame of an animation, which neato -n draws without laying it
+  out again and without moving the nodes between frames.
+ */
+class FixedLayout {
+ public:
+  FixedLayout() {}
+
+  // Adds a node or moves it
+  void setPosition(const std::string& name, double x, double y) {
+    auto it = index.find(name);
+    if (it == index.end()) {
+      index.emplace(name, names.size());
+      names.push_back(name);
+      xs.push_back(x);
+      ys.push_back(y);
+    } else {
+      xs[it->second] = x;
+      ys[it->second] = y;
+    }
+    if (x > width) width = x;
+    if (y > height) height = y;
+  }
+
+  size_t size() const { return names.size(); }
+
+  bool empty() const { return names.empty(); }
+
+  // Position of a node in the layout or -1 if it is not there
+  long indexOf(const std::string& name) const {
+    auto it = index.find(name);
+    return it == index.end() ? -1 : long(it->second);
+  }
+
+  const std::string& getName(size_t node) const { return names[node]; }
+  double getX(size_t node) const { return xs[node]; }
+  double getY(size_t node) const { return ys[node]; }
+
+  // Biggest coordinates of the nodes, the origin is the lower left corner
+  double getWidth() const { return width; }
+  double getHeight() const { return height; }
+
+  /*
+    Reads the nodes of the output of dot -Tplain, whose coordinates are in
+    inches. False if some line of the nodes is malformed.
+    Complexity: linear on the size of the text
+   */
+  bool readPlain(const std::string& plain);
+
+  // The pos attribute of a node, e.g. pos="36,18"
+  template <typename Sink>
+  void writePosition(Sink& out, size_t node) const {
+    out << "pos=\"" << xs[node] << ',' << ys[node] << '"';
+  }
+
+ private:
+  // Next word of a line of -Tplain, false at the end of the line
+  static bool nextWord(const std::string& text, size_t& position, std::string& word);
+
+  std::vector<std::string> names;
+  std::vector<double> xs;
+  std::vector<double> ys;
+  std::unordered_map<std::string, size_t> index;
+  double width = 0;
+  double height = 0;
+};
+
+// ----------------- IMPLEMENTATION --------------------
+
+inline bool FixedLayout::nextWord(const std::string& text, size_t& position,
+                                  std::string& word) {
+    while (position < text.size() and text[position] == ' ') {
+        position++;
+    }
+    if (position >= text.size() or text[position] == '\n') {
+        return false;
+    }
+    word.clear();
+    if (text[position] == '"') { // quoted, with \" and \\ escapes
+        for (position++; position < text.size() and text[position] != '"'; position++) {
+            if (text[position] == '\\' and position + 1 < text.size() and
+                (text[position + 1] == '"' or text[position + 1] == '\\')) {
+                position++;
+            }
+            word += text[position];
+        }
+        position++;
+    } else {
+        while (position < text.size() and text[position] != ' ' and text[position] != '\n') {
+            word += text[position++];
+        }
+    }
+    return true;
+}
+
+inline bool FixedLayout::readPlain(const std::string& plain) {
+    const double POINTS_PER_INCH = 72;
+    size_t position = 0;
+    std::string word, name, x, y;
+    while (position < plain.size()) {
+        if (nextWord(plain, position, word) and word == "node") {
+            if (not nextWord(plain, position, name) or not nextWord(plain, position, x) or
+                not nextWord(plain, position, y)) {
+                return false;
+            }
+            char* x_end;
+            char* y_end;
+            double x_value = std::strtod(x.c_str(), &x_end);
+            double y_value = std::strtod(y.c_str(), &y_end);
+            if (*x_end != '\0' or *y_end != '\0') {
+                return false;
+            }
+            setPosition(name, x_value * POINTS_PER_INCH, y_value * POINTS_PER_INCH);
+        }
+        position = plain.find('\n', position);
+        if (position == std::string::npos) break;
+        position++;
+    }
+    return true;
+}
+
+} // easy_graphs namespace end
+
+#endif // LAYOUT_H
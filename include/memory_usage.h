@@ -0,0 +1,142 @@
+/*
+  Memory accounting: how many bytes the containers of the library hold
+  (Graph::memoryUsage, List::memoryUsage, MinHeap::memoryUsage) and, with
+  counting_allocator.h, how many bytes a program has allocated and the
+  peak reached while an algorithm runs.
+ */
+
+#ifndef MEMORY_USAGE_H
+#define MEMORY_USAGE_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace easy_graphs {
+
+  /*
+    Bytes wasted by the allocator for a block of the given size, estimated
+    as a 64 bit malloc does it: an 8 byte header, blocks rounded to 16
+    bytes and never smaller than 32.
+   */
+  inline size_t allocationOverhead(size_t bytes) {
+    size_t block = (bytes + 8 + 15) / 16 * 16;
+    if (block < 32) block = 32;
+    return block - bytes;
+  }
+
+  /*
+    Bytes of the memory an id owns outside of the object itself, 0 for
+    types which own none. Specialize it for other id types.
+   */
+  template <typename T, typename Enable = void>
+  struct DynamicMemory {
+    static size_t bytes(const T&) { return 0; }
+  };
+
+  template <>
+  struct DynamicMemory<std::string> {
+    // Short strings are kept inside the object by most implementations
+    static size_t bytes(const std::string& text) {
+      const char* data = text.data();
+      const char* object = reinterpret_cast<const char*>(&text);
+      std::less<const char*> less;
+      bool inside = not less(data, object) and less(data, object + sizeof(text));
+      return inside ? 0 : text.capacity() + 1;
+    }
+  };
+
+  // Bytes held by a Graph, see Graph::memoryUsage
+  struct MemoryUsage {
+    size_t vertex_storage = 0;     // the graph and the nodes of its vertex list, but the ids
+    size_t neighbor_nodes = 0;     // nodes of the lists of neighbours and predecessors
+    size_t neighbor_sets = 0;      // arrays of the neighbour sets
+    size_t id_storage = 0;         // the ids, with the memory they own (e.g. long strings)
+    size_t allocator_overhead = 0; // estimated, see allocationOverhead
+
+    size_t total() const {
+      return vertex_storage + neighbor_nodes + neighbor_sets + id_storage + allocator_overhead;
+    }
+
+    // One line of key=value pairs, e.g. for logs or benchmark output
+    template <typename Sink>
+    void write(Sink& out) const {
+      out << "vertex_storage=" << vertex_storage << " neighbor_nodes=" << neighbor_nodes
+          << " neighbor_sets=" << neighbor_sets << " id_storage=" << id_storage
+          << " allocator_overhead=" << allocator_overhead << " total=" << total();
+    }
+  };
+
+  /*
+    Bytes allocated through operator new by the whole program. They are
+    only counted when counting_allocator.h is included in one source file,
+    otherwise everything stays at 0.
+   */
+  class AllocationCounter {
+  public:
+    static size_t current() { return state().current.load(std::memory_order_relaxed); }
+
+    static size_t peak() { return state().peak.load(std::memory_order_relaxed); }
+
+    // Number of allocations since the program started
+    static size_t allocations() { return state().allocations.load(std::memory_order_relaxed); }
+
+    // The peak starts again from the current bytes
+    static void resetPeak() { state().peak.store(current(), std::memory_order_relaxed); }
+
+    // Called by the operators of counting_allocator.h
+    static void allocated(size_t bytes) {
+      Counters& counters = state();
+      size_t now = counters.current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+      counters.allocations.fetch_add(1, std::memory_order_relaxed);
+      size_t seen = counters.peak.load(std::memory_order_relaxed);
+      while (now > seen and
+             not counters.peak.compare_exchange_weak(seen, now, std::memory_order_relaxed)) {
+      }
+    }
+
+    static void released(size_t bytes) {
+      state().current.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+  private:
+    struct Counters {
+      std::atomic<size_t> current{0};
+      std::atomic<size_t> peak{0};
+      std::atomic<size_t> allocations{0};
+    };
+
+    static Counters& state() {
+      static Counters counters;
+      return counters;
+    }
+  };
+
+  /*
+    Peak of the bytes allocated from its construction on, above the bytes
+    that were allocated then, e.g. the extra memory of an algorithm:
+
+      PeakAllocation peak;
+      graph.dijkstra(source);
+      size_t bytes = peak.bytes();
+
+    The counters are global, so allocations of other threads are included
+    and two of them must not be alive at the same time.
+   */
+  class PeakAllocation {
+  public:
+    PeakAllocation() : base(AllocationCounter::current()) {
+      AllocationCounter::resetPeak();
+    }
+
+    size_t bytes() const { return AllocationCounter::peak() - base; }
+
+  private:
+    size_t base;
+  };
+
+  // easy_graphs namespace end
+}
+
+#endif // MEMORY_USAGE_H
@@ -0,0 +1,213 @@
+#ifndef NEIGHBOR_INDEX_H
+#define NEIGHBOR_INDEX_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "list.h"
+#include "neighbor_vertex.h"
+
+namespace easy_graphs {
+
+  template<class T>
+  class Vertex;
+
+  /*
+    Set of the out-neighbours of a vertex, mapping each target to its entry
+    in the adjacency list. Small sets are a sorted contiguous array searched
+    by binary search; above HUB_DEGREE targets the set becomes an open
+    addressing hash table (linear probing) so hubs stay fast too.
+    Complexity: find O(log d) sorted, O(1) expected hashed
+                insert and erase O(d) sorted (one memmove), O(1) hashed
+   */
+  template<class T>
+  class NeighborIndex {
+  public:
+    typedef typename List<NeighborVertex<T>>::Iterator Entry;
+
+    // Neighbours above which the sorted array becomes a hash table
+    static const size_t HUB_DEGREE = 64;
+
+    size_t size() const { return count; }
+
+    bool isHashed() const { return hashed; }
+
+    // Bytes of the array or of the hash table, without allocator overhead
+    size_t memoryUsage() const { return slots.capacity() * sizeof(Slot); }
+
+    // Entry of the edge towards target, NO_ELEMENT if there is none
+    Entry find(const Vertex<T>* target) const;
+
+    // Returns false, without changes, if target was already in the set
+    bool insert(const Vertex<T>* target, Entry entry);
+
+    bool erase(const Vertex<T>* target);
+
+    void clear() {
+      std::vector<Slot>().swap(slots);
+      count = used = 0;
+      bits = 0;
+      hashed = false;
+    }
+
+  private:
+    enum : unsigned char { EMPTY, FULL, ERASED };
+
+    struct Slot {
+      const Vertex<T>* target;
+      Entry entry;
+      unsigned char state;
+    };
+
+    static bool before(const Slot& slot, const Vertex<T>* target) {
+      return std::less<const Vertex<T>*>()(slot.target, target);
+    }
+
+    size_t hash(const Vertex<T>* target) const {
+      uint64_t key = uint64_t(reinterpret_cast<uintptr_t>(target)) >> 4;
+      return size_t((key * 0x9E3779B97F4A7C15ULL) >> (64 - bits));
+    }
+
+    // Slot holding target in the hash table, slots.size() if absent
+    size_t probe(const Vertex<T>* target) const;
+    // Moves the full slots to a hash table of 2^new_bits slots
+    void rehash(unsigned new_bits);
+    // Back to the sorted array once the set is small again
+    void unhash();
+
+    std::vector<Slot> slots;
+    size_t count = 0;
+    size_t used = 0; // full plus erased slots of the hash table
+    unsigned bits = 0;
+    bool hashed = false;
+  };
+
+// ----------------- IMPLEMENTATION --------------------
+
+template <class T>
+typename NeighborIndex<T>::Entry NeighborIndex<T>::find(const Vertex<T>* target) const {
+    if (hashed) {
+        size_t slot = probe(target);
+        return slot == slots.size() ? List<NeighborVertex<T>>::NO_ELEMENT : slots[slot].entry;
+    }
+    auto it = std::lower_bound(slots.begin(), slots.end(), target, before);
+    if (it != slots.end() and it->target == target) {
+        return it->entry;
+    }
+    return List<NeighborVertex<T>>::NO_ELEMENT;
+}
+
+template <class T>
+bool NeighborIndex<T>::insert(const Vertex<T>* target, Entry entry) {
+    if (not hashed) {
+        auto it = std::lower_bound(slots.begin(), slots.end(), target, before);
+        if (it != slots.end() and it->target == target) {
+            return false;
+        }
+        slots.insert(it, Slot{target, entry, FULL});
+        count++;
+        if (count > HUB_DEGREE) {
+            unsigned new_bits = 1;
+            while ((size_t(1) << new_bits) < 2 * count) new_bits++;
+            rehash(new_bits);
+        }
+        return true;
+    }
+    if (probe(target) != slots.size()) {
+        return false;
+    }
+    // Keeps the load, erased slots included, under 3/4
+    if (4 * (used + 1) > 3 * slots.size()) {
+        rehash(4 * (count + 1) > 2 * slots.size() ? bits + 1 : bits);
+    }
+    size_t mask = slots.size() - 1;
+    size_t slot = hash(target);
+    while (slots[slot].state == FULL) {
+        slot = (slot + 1) & mask;
+    }
+    if (slots[slot].state == EMPTY) {
+        used++;
+    }
+    slots[slot] = Slot{target, entry, FULL};
+    count++;
+    return true;
+}
+
+template <class T>
+bool NeighborIndex<T>::erase(const Vertex<T>* target) {
+    if (not hashed) {
+        auto it = std::lower_bound(slots.begin(), slots.end(), target, before);
+        if (it == slots.end() or it->target != target) {
+            return false;
+        }
+        slots.erase(it);
+        count--;
+        return true;
+    }
+    size_t slot = probe(target);
+    if (slot == slots.size()) {
+        return false;
+    }
+    slots[slot].state = ERASED;
+    count--;
+    if (count < HUB_DEGREE / 2) {
+        unhash();
+    }
+    return true;
+}
+
+template <class T>
+size_t NeighborIndex<T>::probe(const Vertex<T>* target) const {
+    size_t mask = slots.size() - 1;
+    for (size_t slot = hash(target); slots[slot].state != EMPTY; slot = (slot + 1) & mask) {
+        if (slots[slot].state == FULL and slots[slot].target == target) {
+            return slot;
+        }
+    }
+    return slots.size();
+}
+
+template <class T>
+void NeighborIndex<T>::rehash(unsigned new_bits) {
+    std::vector<Slot> old;
+    old.swap(slots);
+    bits = new_bits;
+    slots.assign(size_t(1) << bits, Slot{nullptr, List<NeighborVertex<T>>::NO_ELEMENT, EMPTY});
+    size_t mask = slots.size() - 1;
+    for (const Slot& entry : old) {
+        if (entry.state != FULL) continue;
+        size_t slot = hash(entry.target);
+        while (slots[slot].state == FULL) {
+            slot = (slot + 1) & mask;
+        }
+        slots[slot] = entry;
+    }
+    used = count;
+    hashed = true;
+}
+
+template <class T>
+void NeighborIndex<T>::unhash() {
+    std::vector<Slot> sorted;
+    sorted.reserve(count);
+    for (const Slot& slot : slots) {
+        if (slot.state == FULL) {
+            sorted.push_back(slot);
+        }
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const Slot& a, const Slot& b) {
+        return std::less<const Vertex<T>*>()(a.target, b.target);
+    });
+    slots.swap(sorted);
+    used = 0;
+    bits = 0;
+    hashed = false;
+}
+
+  // easy_graphs namespace end
+}
+
+#endif // NEIGHBOR_INDEX_H
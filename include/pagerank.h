@@ -0,0 +1,262 @@
+#ifndef PAGERANK_H
+#define PAGERANK_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "adjacency_snapshot.h"
+#include "compressed_adjacency.h"
+#include "parallel.h"
+
+namespace easy_graphs {
+
+/*
+  PageRank computed by power iteration, i.e. repeated sparse matrix-vector
+  products over the in-edges of the vertices (pull direction): every vertex
+  only reads the contributions of its in-neighbours, so the rows can be
+  split between threads without any synchronization.
+  Ranks are float or double vectors indexed like the vertices of the
+  snapshot. Weights are ignored, the mass of a vertex goes in equal parts
+  to its out-neighbours and the mass of vertices without out-edges goes
+  back to the teleport distribution.
+ */
+template <typename Real = double>
+class PageRank {
+ public:
+  /*
+    Builds the pull adjacency of a snapshot, transposing it when its rows
+    hold out-neighbours. Complexity: O(V + E)
+   */
+  template <typename T>
+  explicit PageRank(const AdjacencySnapshot<T>& graph) {
+    if (graph.isTransposed()) {
+      load(graph);
+    } else {
+      load(graph.transpose());
+    }
+  }
+
+  template <typename T>
+  explicit PageRank(const Graph<T>& graph) {
+    load(AdjacencySnapshot<T>(graph, true));
+  }
+
+  /*
+    Keeps the in-edges compressed and decodes them in every iteration,
+    for graphs whose uncompressed adjacency does not fit in memory.
+    Complexity: O(V + E)
+   */
+  template <typename T>
+  explicit PageRank(const CompressedAdjacency<T>& graph);
+
+  // Probability of following an edge instead of teleporting, 0.85 by default
+  void setDamping(Real damping) { this->damping = damping; }
+
+  // The iteration stops when the L1 norm of the change is below tolerance
+  void setTolerance(Real tolerance) { this->tolerance = tolerance; }
+
+  void setMaxIterations(size_t max_iterations) {
+    this->max_iterations = max_iterations;
+  }
+
+  // Threads used for the products, 0 = hardware concurrency
+  void setThreads(unsigned num_threads) { this->num_threads = num_threads; }
+
+  // Iterations done by the last computation
+  size_t getIterations() const { return iterations; }
+
+  /*
+    Global PageRank, the ranks add up to 1.
+    Complexity: O(V + E) per iteration
+   */
+  std::vector<Real> compute() {
+    return iterate(std::vector<Real>(size, Real(1) / Real(std::max<size_t>(1, size))));
+  }
+
+  /*
+    Personalized PageRank: the teleports land on the given distribution,
+    indexed like the vertices, which is normalized to add up to 1.
+    An empty or zero distribution gives the global PageRank.
+   */
+  std::vector<Real> compute(std::vector<Real> teleport);
+
+  /*
+    Personalized PageRank with the teleports spread evenly on some vertices
+    (vertex indices of the snapshot).
+   */
+  std::vector<Real> compute(const std::vector<uint32_t>& seeds) {
+    std::vector<Real> teleport(size, 0);
+    for (uint32_t seed : seeds) {
+      if (seed < size) teleport[seed] = 1;
+    }
+    return compute(std::move(teleport));
+  }
+
+ private:
+  template <typename T>
+  void load(const AdjacencySnapshot<T>& in_edges);
+  std::vector<Real> iterate(const std::vector<Real>& teleport);
+  // Power iteration with in_sum(v, contribution) adding up the contributions
+  // of the in-neighbours of v, rows balanced by the prefix sum work
+  template <typename InSum>
+  std::vector<Real> iterate(const std::vector<Real>& teleport,
+                            const std::vector<size_t>& work, InSum in_sum);
+
+  size_t size = 0;
+  std::vector<size_t> offsets;      // rows of in-edges
+  std::vector<uint32_t> sources;
+  bool compressed = false;          // rows of in-edges in packed instead
+  CompressedRows packed;
+  std::vector<Real> inverse_degree; // 1 / out-degree, 0 without out-edges
+  Real damping = Real(0.85);
+  Real tolerance = Real(1e-6);
+  size_t max_iterations = 100;
+  unsigned num_threads = 0;
+  size_t iterations = 0;
+};
+
+// ----------------- IMPLEMENTATION --------------------
+
+template <typename Real>
+template <typename T>
+void PageRank<Real>::load(const AdjacencySnapshot<T>& in_edges) {
+    size = in_edges.size();
+    offsets = in_edges.getOffsets();
+    sources = in_edges.getTargets();
+    std::vector<size_t> out_degree(size, 0);
+    for (uint32_t source : sources) {
+        out_degree[source]++;
+    }
+    inverse_degree.resize(size);
+    for (size_t v = 0; v < size; v++) {
+        inverse_degree[v] = out_degree[v] == 0 ? Real(0) : Real(1) / Real(out_degree[v]);
+    }
+}
+
+template <typename Real>
+template <typename T>
+PageRank<Real>::PageRank(const CompressedAdjacency<T>& graph)
+    : size(graph.size()), compressed(true) {
+    std::vector<size_t> out_degree(size, 0);
+    if (graph.isTransposed()) {
+        packed = graph.getRows();
+        for (size_t v = 0; v < size; v++) {
+            for (uint32_t source : packed.row(v)) {
+                out_degree[source]++;
+            }
+        }
+    } else {
+        packed = graph.getRows().transpose();
+        for (size_t v = 0; v < size; v++) {
+            out_degree[v] = graph.degree(v);
+        }
+    }
+    inverse_degree.resize(size);
+    for (size_t v = 0; v < size; v++) {
+        inverse_degree[v] = out_degree[v] == 0 ? Real(0) : Real(1) / Real(out_degree[v]);
+    }
+}
+
+template <typename Real>
+std::vector<Real> PageRank<Real>::compute(std::vector<Real> teleport) {
+    teleport.resize(size, 0);
+    Real total = 0;
+    for (Real value : teleport) {
+        total += value;
+    }
+    if (total <= 0) {
+        return compute();
+    }
+    for (Real& value : teleport) {
+        value /= total;
+    }
+    return iterate(teleport);
+}
+
+template <typename Real>
+std::vector<Real> PageRank<Real>::iterate(const std::vector<Real>& teleport) {
+    if (compressed) {
+        return iterate(teleport, packed.getOffsets(), [this](size_t v, const Real* in) {
+            Real sum = 0;
+            for (uint32_t source : packed.row(v)) {
+                sum += in[source];
+            }
+            return sum;
+        });
+    }
+    return iterate(teleport, offsets, [this](size_t v, const Real* in) {
+        const uint32_t* column = sources.data();
+        Real sum = 0;
+        for (size_t e = offsets[v], last = offsets[v + 1]; e < last; e++) {
+            sum += in[column[e]];
+        }
+        return sum;
+    });
+}
+
+template <typename Real>
+template <typename InSum>
+std::vector<Real> PageRank<Real>::iterate(const std::vector<Real>& teleport,
+                                          const std::vector<size_t>& work,
+                                          InSum in_sum) {
+    std::vector<Real> rank = teleport;
+    std::vector<Real> next(size, 0);
+    std::vector<Real> contribution(size, 0);
+    unsigned threads = resolveThreadCount(num_threads);
+    // Per thread partial sums, padded to keep them in different cache lines
+    const size_t PAD = 64 / sizeof(Real) + 1;
+    std::vector<Real> partial(threads * PAD, 0);
+
+    const Real* teleport_data = teleport.data();
+    for (iterations = 0; iterations < max_iterations; ) {
+        iterations++;
+        // contribution = damping * rank / out-degree, plus the dangling mass
+        parallelFor(0, size, threads, [&](unsigned thread, size_t lo, size_t hi) {
+            const Real* rank_data = rank.data();
+            const Real* inverse = inverse_degree.data();
+            Real* out = contribution.data();
+            Real dangling = 0;
+            for (size_t v = lo; v < hi; v++) {
+                out[v] = damping * rank_data[v] * inverse[v];
+                dangling += inverse[v] == 0 ? rank_data[v] : Real(0);
+            }
+            partial[thread * PAD] = dangling;
+        }, 1 << 14);
+        Real dangling = 0;
+        for (unsigned t = 0; t < threads; t++) {
+            dangling += partial[t * PAD];
+            partial[t * PAD] = 0;
+        }
+        // Lost mass: teleports plus the followed edges of dangling vertices
+        Real base = (1 - damping) + damping * dangling;
+
+        // next = base * teleport + sum of the contributions of the in-edges
+        parallelForBalanced(0, size, work, threads,
+                            [&](unsigned thread, size_t lo, size_t hi) {
+            const Real* in = contribution.data();
+            const Real* rank_data = rank.data();
+            Real* out = next.data();
+            Real change = 0;
+            for (size_t v = lo; v < hi; v++) {
+                out[v] = base * teleport_data[v] + in_sum(v, in);
+                change += std::fabs(out[v] - rank_data[v]);
+            }
+            partial[thread * PAD] = change;
+        }, 1 << 16);
+        Real change = 0;
+        for (unsigned t = 0; t < threads; t++) {
+            change += partial[t * PAD];
+            partial[t * PAD] = 0;
+        }
+        rank.swap(next);
+        if (change < tolerance) break;
+    }
+    return rank;
+}
+
+} // easy_graphs namespace end
+
+#endif // PAGERANK_H
@@ -0,0 +1,135 @@
+/*
+  Minimal helpers to split a range of work between std::threads.
+  Used by the parallel algorithms of the library, they spawn the threads,
+  hand a contiguous slice of the range to each one and join them.
+ */
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace easy_graphs {
+
+  /*
+    Number of threads to use when the caller asks for num_threads.
+    Zero means "as many as the hardware supports".
+   */
+  inline unsigned resolveThreadCount(unsigned num_threads) {
+    if (num_threads == 0) {
+      num_threads = std::thread::hardware_concurrency();
+    }
+    return num_threads == 0 ? 1 : num_threads;
+  }
+
+  /*
+    Calls fn(thread, lo, hi) for disjoint slices [lo, hi) covering [begin, end),
+    one slice per thread. When the range is smaller than grain items per thread
+    the work is done inline in the calling thread, so it is cheap to call it
+    inside loops whose ranges are usually small.
+    The slice handled by the calling thread has thread == 0.
+   */
+  template <typename Function>
+  void parallelFor(size_t begin, size_t end, unsigned num_threads,
+                   Function fn, size_t grain = 1024) {
+    if (begin >= end) return;
+    size_t length = end - begin;
+    size_t threads = resolveThreadCount(num_threads);
+    threads = std::min(threads, std::max<size_t>(1, length / std::max<size_t>(1, grain)));
+    if (threads <= 1) {
+      fn(0u, begin, end);
+      return;
+    }
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    size_t slice = (length + threads - 1) / threads;
+    for (size_t t = 1; t < threads; t++) {
+      size_t lo = begin + t * slice;
+      size_t hi = std::min(end, lo + slice);
+      if (lo >= hi) break;
+      workers.emplace_back(fn, unsigned(t), lo, hi);
+    }
+    fn(0u, begin, std::min(end, begin + slice));
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+  }
+
+  /*
+    Like parallelFor but the slices are balanced by a prefix sum instead of
+    by the number of items, i.e. by edges instead of by vertices.
+    prefix must have end + 1 entries and be non decreasing.
+   */
+  template <typename Prefix, typename Function>
+  void parallelForBalanced(size_t begin, size_t end, const Prefix& prefix,
+                           unsigned num_threads, Function fn,
+                           size_t grain = 4096) {
+    if (begin >= end) return;
+    size_t work = prefix[end] - prefix[begin] + (end - begin);
+    size_t threads = resolveThreadCount(num_threads);
+    threads = std::min(threads, std::max<size_t>(1, work / std::max<size_t>(1, grain)));
+    if (threads <= 1) {
+      fn(0u, begin, end);
+      return;
+    }
+    std::vector<size_t> bounds(threads + 1, end);
+    bounds[0] = begin;
+    size_t current = begin;
+    for (size_t t = 1; t < threads; t++) {
+      size_t target = work * t / threads;
+      while (current < end and
+             prefix[current] - prefix[begin] + (current - begin) < target) {
+        current++;
+      }
+      bounds[t] = current;
+    }
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (size_t t = 1; t < threads; t++) {
+      if (bounds[t] < bounds[t + 1]) {
+        workers.emplace_back(fn, unsigned(t), bounds[t], bounds[t + 1]);
+      }
+    }
+    fn(0u, bounds[0], bounds[1]);
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+  }
+
+  /*
+    Like parallelFor but the range is handed out in chunks of chunk items
+    through an atomic counter, for loops whose items have very different
+    costs (e.g. one item per vertex, with hubs and leaves).
+   */
+  template <typename Function>
+  void parallelForDynamic(size_t begin, size_t end, unsigned num_threads,
+                          Function fn, size_t chunk = 256) {
+    if (begin >= end) return;
+    chunk = std::max<size_t>(1, chunk);
+    size_t chunks = (end - begin + chunk - 1) / chunk;
+    size_t threads = std::min<size_t>(resolveThreadCount(num_threads), chunks);
+    std::atomic<size_t> next(begin);
+    auto worker = [&](unsigned thread) {
+      for (size_t lo = next.fetch_add(chunk); lo < end; lo = next.fetch_add(chunk)) {
+        fn(thread, lo, std::min(end, lo + chunk));
+      }
+    };
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (size_t t = 1; t < threads; t++) {
+      workers.emplace_back(worker, unsigned(t));
+    }
+    worker(0u);
+    for (std::thread& thread : workers) {
+      thread.join();
+    }
+  }
+
+  // easy_graphs namespace end
+}
+
+#endif // PARALLEL_H
@@ -0,0 +1,139 @@
+#ifndef SPARSE_MATRIX_H
+#define SPARSE_MATRIX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace easy_graphs {
+
+/*
+  Entry of a sparse matrix with the interface of Eigen::Triplet: a range of
+  them can be given to Eigen::SparseMatrix::setFromTriplets, and a range of
+  Eigen triplets can be read with the same code as a range of these.
+ */
+template <typename Scalar = int, typename Index = int>
+class Triplet {
+ public:
+  Triplet() : r(0), c(0), v(0) {}
+  Triplet(Index row, Index col, Scalar value = Scalar(1))
+      : r(row), c(col), v(value) {}
+
+  Index row() const { return r; }
+  Index col() const { return c; }
+  Scalar value() const { return v; }
+
+ private:
+  Index r;
+  Index c;
+  Scalar v;
+};
+
+/*
+  Sparse matrix in coordinate format: entry k is
+  (row_indices[k], column_indices[k], values[k]), in any order.
+ */
+struct CooMatrix {
+  size_t rows = 0;
+  size_t cols = 0;
+  std::vector<uint32_t> row_indices;
+  std::vector<uint32_t> column_indices;
+  std::vector<int> values;
+
+  size_t nonZeros() const { return values.size(); }
+};
+
+/*
+  Sparse matrix in compressed sparse rows: the entries of row i are
+  columns[k] and values[k] for k in [offsets[i], offsets[i + 1]).
+ */
+struct CsrMatrix {
+  size_t rows = 0;
+  size_t cols = 0;
+  std::vector<size_t> offsets = {0};
+  std::vector<uint32_t> columns;
+  std::vector<int> values;
+
+  size_t nonZeros() const { return values.size(); }
+};
+
+/*
+  Coordinate matrix from a range of triplets (ours or Eigen's).
+  Complexity: O(number of triplets)
+ */
+template <typename Range>
+CooMatrix cooFromTriplets(size_t rows, size_t cols, const Range& triplets) {
+  CooMatrix matrix;
+  matrix.rows = rows;
+  matrix.cols = cols;
+  for (const auto& triplet : triplets) {
+    matrix.row_indices.push_back(uint32_t(triplet.row()));
+    matrix.column_indices.push_back(uint32_t(triplet.col()));
+    matrix.values.push_back(int(triplet.value()));
+  }
+  return matrix;
+}
+
+inline std::vector<Triplet<int>> toTriplets(const CooMatrix& matrix) {
+  std::vector<Triplet<int>> triplets;
+  triplets.reserve(matrix.nonZeros());
+  for (size_t k = 0; k < matrix.nonZeros(); k++) {
+    triplets.push_back(Triplet<int>(int(matrix.row_indices[k]),
+                                    int(matrix.column_indices[k]), matrix.values[k]));
+  }
+  return triplets;
+}
+
+/*
+  Groups the entries by row with a counting sort, every row keeps the order
+  of its entries in the coordinate matrix. Entries out of the bounds of
+  the matrix are dropped.
+  Complexity: O(rows + entries)
+ */
+inline CsrMatrix toCsr(const CooMatrix& matrix) {
+  CsrMatrix result;
+  result.rows = matrix.rows;
+  result.cols = matrix.cols;
+  result.offsets.assign(matrix.rows + 1, 0);
+  size_t entries = matrix.nonZeros();
+  for (size_t k = 0; k < entries; k++) {
+    if (matrix.row_indices[k] < matrix.rows and matrix.column_indices[k] < matrix.cols) {
+      result.offsets[matrix.row_indices[k] + 1]++;
+    }
+  }
+  for (size_t i = 0; i < matrix.rows; i++) {
+    result.offsets[i + 1] += result.offsets[i];
+  }
+  result.columns.resize(result.offsets[matrix.rows]);
+  result.values.resize(result.offsets[matrix.rows]);
+  std::vector<size_t> next(result.offsets.begin(), result.offsets.end() - 1);
+  for (size_t k = 0; k < entries; k++) {
+    uint32_t row = matrix.row_indices[k];
+    if (row < matrix.rows and matrix.column_indices[k] < matrix.cols) {
+      size_t position = next[row]++;
+      result.columns[position] = matrix.column_indices[k];
+      result.values[position] = matrix.values[k];
+    }
+  }
+  return result;
+}
+
+// Complexity: O(rows + entries)
+inline CooMatrix toCoo(const CsrMatrix& matrix) {
+  CooMatrix result;
+  result.rows = matrix.rows;
+  result.cols = matrix.cols;
+  result.row_indices.resize(matrix.nonZeros());
+  result.column_indices = matrix.columns;
+  result.values = matrix.values;
+  for (size_t i = 0; i < matrix.rows; i++) {
+    for (size_t k = matrix.offsets[i]; k < matrix.offsets[i + 1]; k++) {
+      result.row_indices[k] = uint32_t(i);
+    }
+  }
+  return result;
+}
+
+} // easy_graphs namespace end
+
+#endif // SPARSE_MATRIX_H
@@ -1,58 +1,323 @@
-/*
-  Implementation of utility functions which make a system call
-  to graphiz in order to generate image representations of graphs
-  using their dot-representation.
-  
-  @author Christian González León
- */
-
-#ifndef DOT_EXTENCION_H
-#define DOT_EXTENCION_H
-
-#include <string>
-#include <fstream>
-#include <cstdlib>
-
-struct dot_extension {
-  static std::string dotPath;  
-
-  inline static bool dotRepr2PNG(const std::string& dot_repr,
-      const std::string& filename, const std::string& folder = "") {
-    if (dotPath.empty()) return false;    
-        
-    std::ofstream ofs("graph.gv");
-    if (ofs.fail()) {
-      ofs.close();
-      return false;
-    }
-    ofs << dot_repr;
-    ofs.close();
-    system((dotPath + " -Tpng graph.gv -o " + filename + ".png").c_str());
-    if (!folder.empty()) {
-      system(std::string("move " + filename + ".png " + folder).c_str());
-    }
-    return true;
-  }
-
-  inline static bool dotRepr2JPEG(const std::string& dot_repr,
-      const std::string& filename, const std::string& folder = "") {
-    if (dotPath.empty()) return false;
-        
-    std::ofstream ofs("graph.gv");
-    if (ofs.fail()) {
-      ofs.close();
-      return false;
-    }
-    ofs << dot_repr;
-    ofs.close();
-    system((dotPath + " -Tjpeg graph.gv -o " + filename + ".jpg").c_str());
-    if (!folder.empty()) {
-      system(std::string("move " + filename + ".png " + folder).c_str());
-    }
-    return true;
-  }  
-  
-  
-};
-
-#endif // DOT_EXTENCION_H
+/*
+  Implementation of utility functions which make a system call
+  to graphiz in order to generate image representations of graphs
+  using their dot-representation.
+  The dot text goes to the dot process through a pipe, so there are no
+  temporary files and concurrent calls do not interfere: the pipes are
+  closed on exec, so no other child process keeps one of them open.
+
+  @author Christian González León
+ */
+
+#ifndef DOT_EXTENCION_H
+#define DOT_EXTENCION_H
+
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../layout.h"
+#include "../parallel.h"
+#include "../trace.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define EASY_GRAPHS_POSIX_PIPES 1
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__)
+#define EASY_GRAPHS_PIPE2 1
+#endif
+#endif
+
+struct dot_extension {
+  static std::string dotPath;
+
+  // Options of dot to draw frames with fixed positions: neato -n
+  static constexpr const char* PINNED = "-Kneato -n";
+
+  inline static bool dotRepr2PNG(const std::string& dot_repr,
+      const std::string& filename, const std::string& folder = "") {
+    return renderFrame(dot_repr, "png", outputPath(filename + ".png", folder));
+  }
+
+  inline static bool dotRepr2JPEG(const std::string& dot_repr,
+      const std::string& filename, const std::string& folder = "") {
+    return renderFrame(dot_repr, "jpeg", outputPath(filename + ".jpg", folder));
+  }
+
+  /*
+    Runs dot with the given output format ("png", "jpeg", "svg", ...),
+    writing dot_repr to its standard input. True if dot succeeded.
+    options are more arguments for dot, e.g. PINNED for the pinned frames
+    of AnimationFrames::pinned and DijkstraTrace::pinned.
+   */
+  inline static bool renderFrame(const std::string& dot_repr,
+      const std::string& format, const std::string& output_path,
+      const std::string& options = "") {
+    EASY_GRAPHS_TRACE("dot_extension::renderFrame");
+    if (dotPath.empty()) return false;
+    std::string command = quote(dotPath) + " -T" + format + " -o " + quote(output_path) +
+                          (options.empty() ? "" : " " + options);
+#ifdef EASY_GRAPHS_POSIX_PIPES
+    std::FILE* pipe;
+    {
+      // Not while filter has pipes still inheritable, see makePipe
+      ForkGuard guard;
+      pipe = popen(command.c_str(), "w");
+    }
+#else
+    std::FILE* pipe = _popen(command.c_str(), "wb");
+#endif
+    if (pipe == nullptr) return false;
+#ifdef EASY_GRAPHS_POSIX_PIPES
+    // If dot dies before reading everything the write fails with EPIPE
+    // instead of killing the process with SIGPIPE
+    sigset_t sigpipe, previous;
+    sigemptyset(&sigpipe);
+    sigaddset(&sigpipe, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &sigpipe, &previous);
+#endif
+    bool written = std::fwrite(dot_repr.data(), 1, dot_repr.size(), pipe) == dot_repr.size();
+#ifdef EASY_GRAPHS_POSIX_PIPES
+    int status = pclose(pipe);
+    sigset_t pending;
+    sigpending(&pending);
+    if (sigismember(&pending, SIGPIPE) and not sigismember(&previous, SIGPIPE)) {
+      int signal_number;
+      sigwait(&sigpipe, &signal_number);
+    }
+    pthread_sigmask(SIG_SETMASK, &previous, nullptr);
+    return written and status != -1 and WIFEXITED(status) and WEXITSTATUS(status) == 0;
+#else
+    return _pclose(pipe) == 0 and written;
+#endif
+  }
+
+  /*
+    Renders a batch of frames, e.g. the List returned by
+    Graph::bfs_animation or, without building all of them first, the
+    AnimationFrames of Graph::bfs_frames or a DijkstraTrace. Frame i goes to
+    path_prefix + i + extension, at most num_processes dot processes run at
+    the same time (0 = hardware concurrency) and the frames are taken from
+    the range one at a time, so only those being rendered are in memory.
+    Returns whether every frame was rendered, in the order of the range.
+   */
+  template <typename Range>
+  static std::vector<bool> renderFrames(const Range& frames,
+      const std::string& format, const std::string& path_prefix,
+      unsigned num_processes = 0, const std::string& options = "") {
+    EASY_GRAPHS_TRACE("dot_extension::renderFrames");
+    std::mutex lock;
+    auto next = std::begin(frames);
+    auto last = std::end(frames);
+    size_t taken = 0;
+    std::vector<char> rendered;
+    std::string extension = format == "jpeg" ? "jpg" : format;
+    auto worker = [&]() {
+      while (true) {
+        std::string frame;
+        size_t position;
+        {
+          std::lock_guard<std::mutex> guard(lock);
+          if (next == last) return;
+          frame = *next;
+          ++next;
+          position = taken++;
+          rendered.push_back(0);
+        }
+        bool done = renderFrame(frame, format,
+            path_prefix + std::to_string(position) + "." + extension, options);
+        std::lock_guard<std::mutex> guard(lock);
+        rendered[position] = done;
+      }
+    };
+    unsigned processes = easy_graphs::resolveThreadCount(num_processes);
+    std::vector<std::thread> workers;
+    for (unsigned i = 1; i < processes; i++) {
+      workers.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& thread : workers) {
+      thread.join();
+    }
+    return std::vector<bool>(rendered.begin(), rendered.end());
+  }
+
+  /*
+    Lays out a graph with one run of dot (or of another engine given in
+    the options, e.g. "-Kneato") and reads the positions of its nodes, to
+    draw all the frames of an animation of the graph with them:
+
+      FixedLayout layout;
+      dot_extension::computeLayout(graph.dotRepr(), layout);
+      dot_extension::renderFrames(graph.bfs_frames(root).pinned(layout),
+                                  "png", "bfs", 0, dot_extension::PINNED);
+
+    False if dot failed. Only where there are POSIX pipes.
+    It can be called from several threads at once, also while renderFrames
+    runs: the pipes of each call are closed on exec, so the dot process of
+    a call never holds the input of another one open.
+   */
+  inline static bool computeLayout(const std::string& dot_repr,
+      easy_graphs::FixedLayout& layout, const std::string& options = "") {
+    EASY_GRAPHS_TRACE("dot_extension::computeLayout");
+    std::string plain;
+    if (dotPath.empty() or not filter(quote(dotPath) + " -Tplain " + options,
+                                      dot_repr, plain)) {
+      return false;
+    }
+    return layout.readPlain(plain);
+  }
+
+private:
+#ifdef EASY_GRAPHS_POSIX_PIPES
+  /*
+    Without pipe2 a pipe is inheritable until fcntl marks it, so its
+    creation and every fork of the library (filter and the popen of
+    renderFrame) take this lock. With pipe2 it does nothing.
+   */
+  struct ForkGuard {
+#ifdef EASY_GRAPHS_PIPE2
+    ForkGuard() {}
+#else
+    ForkGuard() : guard(mutex()) {}
+    static std::mutex& mutex() {
+      static std::mutex forks;
+      return forks;
+    }
+    std::lock_guard<std::mutex> guard;
+#endif
+  };
+
+  // A pipe whose two ends are closed on exec
+  inline static bool makePipe(int ends[2]) {
+#ifdef EASY_GRAPHS_PIPE2
+    return pipe2(ends, O_CLOEXEC) == 0;
+#else
+    if (pipe(ends) != 0) return false;
+    fcntl(ends[0], F_SETFD, FD_CLOEXEC);
+    fcntl(ends[1], F_SETFD, FD_CLOEXEC);
+    return true;
+#endif
+  }
+
+  // In the child: end as the standard descriptor target, kept on exec
+  inline static void redirect(int end, int target) {
+    if (end == target) {
+      fcntl(end, F_SETFD, 0);
+    } else {
+      dup2(end, target); // the copy is not closed on exec
+    }
+  }
+#endif
+
+  // Runs a command with input as its standard input and keeps its output
+  inline static bool filter(const std::string& command, const std::string& input,
+                            std::string& output) {
+#ifdef EASY_GRAPHS_POSIX_PIPES
+    int to_child[2], from_child[2];
+    pid_t child;
+    {
+      ForkGuard guard;
+      if (not makePipe(to_child)) return false;
+      if (not makePipe(from_child)) {
+        ::close(to_child[0]);
+        ::close(to_child[1]);
+        return false;
+      }
+      child = fork();
+    }
+    if (child == 0) {
+      // The four ends are closed by exec, only the copies stay
+      redirect(to_child[0], 0);
+      redirect(from_child[1], 1);
+      execl("/bin/sh", "sh", "-c", command.c_str(), static_cast<char*>(nullptr));
+      _exit(127);
+    }
+    ::close(to_child[0]);
+    ::close(from_child[1]);
+    if (child < 0) {
+      ::close(to_child[1]);
+      ::close(from_child[0]);
+      return false;
+    }
+    // The input is written by another thread while this one reads, so
+    // neither process waits for the other with a full pipe
+    std::thread writer([&]() {
+      sigset_t sigpipe;
+      sigemptyset(&sigpipe);
+      sigaddset(&sigpipe, SIGPIPE);
+      pthread_sigmask(SIG_BLOCK, &sigpipe, nullptr);
+      const char* data = input.data();
+      size_t left = input.size();
+      while (left > 0) {
+        ssize_t written = ::write(to_child[1], data, left);
+        if (written < 0) {
+          if (errno == EINTR) continue;
+          break;
+        }
+        data += written;
+        left -= size_t(written);
+      }
+      ::close(to_child[1]);
+      sigset_t pending;
+      sigpending(&pending);
+      if (sigismember(&pending, SIGPIPE)) {
+        int signal_number;
+        sigwait(&sigpipe, &signal_number);
+      }
+    });
+    output.clear();
+    char buffer[1 << 14];
+    while (true) {
+      ssize_t bytes = ::read(from_child[0], buffer, sizeof(buffer));
+      if (bytes < 0 and errno == EINTR) continue;
+      if (bytes <= 0) break;
+      output.append(buffer, size_t(bytes));
+    }
+    ::close(from_child[0]);
+    writer.join();
+    int status;
+    while (waitpid(child, &status, 0) < 0) {
+      if (errno != EINTR) return false;
+    }
+    return WIFEXITED(status) and WEXITSTATUS(status) == 0;
+#else
+    (void)command;
+    (void)input;
+    (void)output;
+    return false;
+#endif
+  }
+
+  inline static std::string outputPath(const std::string& filename,
+                                       const std::string& folder) {
+    return folder.empty() ? filename : folder + "/" + filename;
+  }
+
+  // Argument for the shell
+  inline static std::string quote(const std::string& argument) {
+#ifdef EASY_GRAPHS_POSIX_PIPES
+    std::string quoted = "'";
+    for (char c : argument) {
+      if (c == '\'') {
+        quoted += "'\\''";
+      } else {
+        quoted += c;
+      }
+    }
+    return quoted + "'";
+#else
+    return "\"" + argument + "\"";
+#endif
+  }
+};
+
+#endif // DOT_EXTENCION_H
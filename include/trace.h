@@ -0,0 +1,171 @@
+/*
+  Scoped tracing of the phases of the library (construction, lookups,
+  traversals, DOT output and rendering) to see where the time goes in a
+  capture. Compiled in only when EASY_GRAPHS_ENABLE_TRACING is defined
+  before including the library, otherwise EASY_GRAPHS_TRACE expands to
+  nothing and there is no code at all in the traced functions.
+
+  Every span goes to a fixed size ring buffer of 32 byte records,
+  TraceBuffer::global(), where the oldest spans are overwritten, and
+  writeChromeTrace converts it to the Trace Event JSON that
+  chrome://tracing and Perfetto open:
+
+    easy_graphs::BufferedWriter out("capture.json");
+    easy_graphs::TraceBuffer::global().writeChromeTrace(out);
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace easy_graphs {
+
+  // A finished span, times in nanoseconds of the steady clock
+  struct TraceEvent {
+    const char* name = nullptr; // a string literal
+    uint64_t start = 0;
+    uint64_t duration = 0;
+    uint32_t thread = 0;        // small number given to each thread
+  };
+
+  class TraceBuffer {
+  public:
+    // capacity is rounded up to a power of two
+    explicit TraceBuffer(size_t capacity = size_t(1) << 16) {
+      size_t size = 1;
+      while (size < capacity) size <<= 1;
+      ring.resize(size);
+      mask = size - 1;
+    }
+
+    TraceBuffer(const TraceBuffer&) = delete;
+    TraceBuffer& operator=(const TraceBuffer&) = delete;
+
+    // The buffer where EASY_GRAPHS_TRACE records
+    static TraceBuffer& global() {
+      static TraceBuffer buffer;
+      return buffer;
+    }
+
+    static uint64_t now() {
+      return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    /*
+      Safe to call from several threads at the same time, but the spans
+      must not be read (events, writeChromeTrace) while they are recorded.
+      Complexity: O(1)
+     */
+    void record(const char* name, uint64_t start, uint64_t end) {
+      uint64_t position = next.fetch_add(1, std::memory_order_relaxed);
+      TraceEvent& event = ring[position & mask];
+      event.name = name;
+      event.start = start;
+      event.duration = end - start;
+      event.thread = threadNumber();
+    }
+
+    // Spans kept, at most the capacity
+    size_t size() const {
+      uint64_t recorded = next.load(std::memory_order_relaxed);
+      return recorded < ring.size() ? size_t(recorded) : ring.size();
+    }
+
+    // Spans overwritten by newer ones
+    uint64_t dropped() const { return next.load(std::memory_order_relaxed) - size(); }
+
+    void clear() { next.store(0, std::memory_order_relaxed); }
+
+    // The spans kept, in the order they finished
+    std::vector<TraceEvent> events() const {
+      uint64_t recorded = next.load(std::memory_order_relaxed);
+      std::vector<TraceEvent> kept;
+      kept.reserve(size());
+      for (uint64_t i = recorded - size(); i < recorded; i++) {
+        kept.push_back(ring[i & mask]);
+      }
+      return kept;
+    }
+
+    /*
+      Trace Event JSON with one complete ("X") event per span, times in
+      microseconds.
+      Complexity: O(size())
+     */
+    template <typename Sink>
+    void writeChromeTrace(Sink& out) const {
+      out << "{\"traceEvents\":[";
+      bool first = true;
+      for (const TraceEvent& event : events()) {
+        out << (first ? "\n" : ",\n") << "{\"name\":\"" << event.name
+            << "\",\"cat\":\"easy_graphs\",\"ph\":\"X\",\"ts\":"
+            << Microseconds(event.start).text << ",\"dur\":"
+            << Microseconds(event.duration).text << ",\"pid\":1,\"tid\":"
+            << event.thread << '}';
+        first = false;
+      }
+      out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    }
+
+  private:
+    // Nanoseconds as microseconds with three decimals
+    struct Microseconds {
+      explicit Microseconds(uint64_t nanoseconds) {
+        std::snprintf(text, sizeof(text), "%llu.%03u",
+                      static_cast<unsigned long long>(nanoseconds / 1000),
+                      unsigned(nanoseconds % 1000));
+      }
+      char text[32];
+    };
+
+    static uint32_t threadNumber() {
+      static std::atomic<uint32_t> threads(0);
+      thread_local uint32_t number = threads.fetch_add(1, std::memory_order_relaxed);
+      return number;
+    }
+
+    std::vector<TraceEvent> ring;
+    size_t mask;
+    std::atomic<uint64_t> next{0};
+  };
+
+  // Records the span from its construction to its destruction
+  class TraceScope {
+  public:
+    explicit TraceScope(const char* name) : name(name), start(TraceBuffer::now()) {}
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    ~TraceScope() { TraceBuffer::global().record(name, start, TraceBuffer::now()); }
+
+  private:
+    const char* name;
+    uint64_t start;
+  };
+
+  // easy_graphs namespace end
+}
+
+#define EASY_GRAPHS_TRACE_JOIN(a, b) a##b
+#define EASY_GRAPHS_TRACE_VARIABLE(line) EASY_GRAPHS_TRACE_JOIN(easy_graphs_trace_, line)
+
+/*
+  Traces the rest of the enclosing block as a span called name, which must
+  be a string literal without quotes nor backslashes.
+ */
+#ifdef EASY_GRAPHS_ENABLE_TRACING
+#define EASY_GRAPHS_TRACE(name) \
+  ::easy_graphs::TraceScope EASY_GRAPHS_TRACE_VARIABLE(__LINE__)(name)
+#else
+#define EASY_GRAPHS_TRACE(name) ((void)0)
+#endif
+
+#endif // TRACE_H
@@ -0,0 +1,349 @@
+#ifndef TRIANGLES_H
+#define TRIANGLES_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define EASY_GRAPHS_SSE2 1
+#endif
+
+#include "adjacency_snapshot.h"
+#include "parallel.h"
+
+namespace easy_graphs {
+
+/*
+  Degree ordered orientation of a simple undirected graph: vertices are
+  renamed by their rank (ascending degree, ties by index) and each edge
+  {u, v} is kept only in the row of the endpoint of lower rank. Rows are
+  sorted and without duplicates, so every triangle is found exactly once by
+  intersecting the row of a vertex with the rows of its neighbours, and no
+  row is longer than sqrt(2E).
+  Directed graphs are taken as undirected, self loops and parallel edges
+  are dropped.
+ */
+struct OrientedAdjacency {
+  /*
+    Builds the orientation from the rows of the snapshot (and of its
+    transpose for directed graphs). Complexity: O(V log V + E)
+   */
+  template <typename T>
+  explicit OrientedAdjacency(const AdjacencySnapshot<T>& graph);
+
+  size_t size() const { return vertex_of_rank.size(); }
+
+  std::vector<size_t> offsets;         // rows by rank
+  std::vector<uint32_t> targets;       // ranks, sorted within each row
+  std::vector<uint32_t> vertex_of_rank;
+  std::vector<uint32_t> degree;        // simple undirected degree by rank
+};
+
+// Number of elements shared by two sorted arrays without duplicates
+inline size_t intersectionSize(const uint32_t* a, size_t a_size,
+                               const uint32_t* b, size_t b_size);
+
+/*
+  Calls found(x) for each element shared by two sorted arrays without
+  duplicates. Merges both arrays, or gallops through the longest one when
+  their sizes are very different.
+ */
+template <typename Found>
+void intersect(const uint32_t* a, size_t a_size, const uint32_t* b,
+               size_t b_size, Found found);
+
+/*
+  Number of triangles of the graph.
+  Complexity: O(E * sqrt(E)) split between num_threads (0 = all cores)
+ */
+template <typename T>
+uint64_t countTriangles(const AdjacencySnapshot<T>& graph,
+                        unsigned num_threads = 0);
+
+// Number of triangles of each vertex, indexed like the snapshot
+template <typename T>
+std::vector<uint64_t> vertexTriangles(const AdjacencySnapshot<T>& graph,
+                                      unsigned num_threads = 0);
+
+/*
+  Local clustering coefficient of each vertex: the fraction of pairs of
+  neighbours which are joined by an edge, 0 for degrees below 2.
+ */
+template <typename T>
+std::vector<double> clusteringCoefficients(const AdjacencySnapshot<T>& graph,
+                                           unsigned num_threads = 0);
+
+template <typename T>
+uint64_t countTriangles(const Graph<T>& graph, unsigned num_threads = 0) {
+  return countTriangles(AdjacencySnapshot<T>(graph), num_threads);
+}
+
+template <typename T>
+std::vector<uint64_t> vertexTriangles(const Graph<T>& graph,
+                                      unsigned num_threads = 0) {
+  return vertexTriangles(AdjacencySnapshot<T>(graph), num_threads);
+}
+
+template <typename T>
+std::vector<double> clusteringCoefficients(const Graph<T>& graph,
+                                           unsigned num_threads = 0) {
+  return clusteringCoefficients(AdjacencySnapshot<T>(graph), num_threads);
+}
+
+// ----------------- IMPLEMENTATION --------------------
+
+template <typename T>
+OrientedAdjacency::OrientedAdjacency(const AdjacencySnapshot<T>& graph) {
+    size_t size = graph.size();
+    AdjacencySnapshot<T> reverse;
+    if (graph.isDirected()) {
+        reverse = graph.transpose();
+    }
+    std::vector<const AdjacencySnapshot<T>*> sides = {&graph};
+    if (graph.isDirected()) {
+        sides.push_back(&reverse);
+    }
+
+    std::vector<std::pair<size_t, uint32_t>> by_degree(size);
+    for (size_t v = 0; v < size; v++) {
+        size_t total = 0;
+        for (const AdjacencySnapshot<T>* side : sides) {
+            total += side->degree(v);
+        }
+        by_degree[v] = std::make_pair(total, uint32_t(v));
+    }
+    std::sort(by_degree.begin(), by_degree.end());
+    std::vector<uint32_t> rank_of_vertex(size);
+    vertex_of_rank.resize(size);
+    for (size_t r = 0; r < size; r++) {
+        vertex_of_rank[r] = by_degree[r].second;
+        rank_of_vertex[by_degree[r].second] = uint32_t(r);
+    }
+
+    // Appending each vertex, by increasing rank, to the rows of its lower
+    // ranked neighbours leaves every row sorted, with duplicates adjacent
+    std::vector<size_t> starts(size + 1, 0);
+    for (size_t r = 0; r < size; r++) {
+        for (const AdjacencySnapshot<T>* side : sides) {
+            uint32_t vertex = vertex_of_rank[r];
+            for (size_t e = side->rowBegin(vertex); e < side->rowEnd(vertex); e++) {
+                uint32_t lower = rank_of_vertex[side->target(e)];
+                if (lower < r) starts[lower + 1]++;
+            }
+        }
+    }
+    for (size_t r = 0; r < size; r++) {
+        starts[r + 1] += starts[r];
+    }
+    targets.resize(starts[size]);
+    std::vector<size_t> next(starts.begin(), starts.end() - 1);
+    for (size_t r = 0; r < size; r++) {
+        for (const AdjacencySnapshot<T>* side : sides) {
+            uint32_t vertex = vertex_of_rank[r];
+            for (size_t e = side->rowBegin(vertex); e < side->rowEnd(vertex); e++) {
+                uint32_t lower = rank_of_vertex[side->target(e)];
+                if (lower < r) targets[next[lower]++] = uint32_t(r);
+            }
+        }
+    }
+
+    // Drops the duplicates compacting the rows in place
+    offsets.assign(size + 1, 0);
+    degree.assign(size, 0);
+    size_t write = 0;
+    for (size_t r = 0; r < size; r++) {
+        offsets[r] = write;
+        for (size_t e = starts[r]; e < starts[r + 1]; e++) {
+            if (write == offsets[r] or targets[write - 1] != targets[e]) {
+                targets[write++] = targets[e];
+                degree[targets[e]]++;
+            }
+        }
+        degree[r] += uint32_t(write - offsets[r]);
+    }
+    offsets[size] = write;
+    targets.resize(write);
+    targets.shrink_to_fit();
+}
+
+inline size_t intersectionSize(const uint32_t* a, size_t a_size,
+                               const uint32_t* b, size_t b_size) {
+    size_t i = 0, j = 0, count = 0;
+#ifdef EASY_GRAPHS_SSE2
+    // Compares blocks of 4 against the 4 rotations of the other block
+    while (i + 4 <= a_size and j + 4 <= b_size) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+        __m128i match = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi32(va, vb),
+                         _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1)))),
+            _mm_or_si128(_mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))),
+                         _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3)))));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(match));
+        count += size_t((mask & 1) + ((mask >> 1) & 1) + ((mask >> 2) & 1) + ((mask >> 3) & 1));
+        uint32_t a_last = a[i + 3];
+        uint32_t b_last = b[j + 3];
+        if (a_last <= b_last) i += 4;
+        if (b_last <= a_last) j += 4;
+    }
+#endif
+    while (i < a_size and j < b_size) {
+        if (a[i] < b[j]) {
+            i++;
+        } else if (b[j] < a[i]) {
+            j++;
+        } else {
+            count++;
+            i++;
+            j++;
+        }
+    }
+    return count;
+}
+
+template <typename Found>
+void intersect(const uint32_t* a, size_t a_size, const uint32_t* b,
+               size_t b_size, Found found) {
+    if (a_size > b_size) {
+        std::swap(a, b);
+        std::swap(a_size, b_size);
+    }
+    if (a_size * 32 < b_size) {
+        // Galloping: exponential then binary search of each element of a
+        size_t low = 0;
+        for (size_t i = 0; i < a_size and low < b_size; i++) {
+            size_t step = 1;
+            size_t high = low;
+            while (high < b_size and b[high] < a[i]) {
+                low = high + 1;
+                high += step;
+                step *= 2;
+            }
+            high = std::min(high + 1, b_size);
+            low = size_t(std::lower_bound(b + low, b + high, a[i]) - b);
+            if (low < b_size and b[low] == a[i]) {
+                found(a[i]);
+                low++;
+            }
+        }
+        return;
+    }
+    size_t i = 0, j = 0;
+    while (i < a_size and j < b_size) {
+        if (a[i] < b[j]) {
+            i++;
+        } else if (b[j] < a[i]) {
+            j++;
+        } else {
+            found(a[i]);
+            i++;
+            j++;
+        }
+    }
+}
+
+template <typename T>
+uint64_t countTriangles(const AdjacencySnapshot<T>& graph,
+                        unsigned num_threads) {
+    OrientedAdjacency oriented(graph);
+    const size_t* offsets = oriented.offsets.data();
+    const uint32_t* targets = oriented.targets.data();
+    std::atomic<uint64_t> total(0);
+    parallelForDynamic(0, oriented.size(), num_threads,
+                       [&](unsigned, size_t lo, size_t hi) {
+        uint64_t local = 0;
+        for (size_t u = lo; u < hi; u++) {
+            const uint32_t* row = targets + offsets[u];
+            size_t row_size = offsets[u + 1] - offsets[u];
+            for (size_t e = 0; e < row_size; e++) {
+                uint32_t v = row[e];
+                local += intersectionSize(row + e + 1, row_size - e - 1,
+                                          targets + offsets[v],
+                                          offsets[v + 1] - offsets[v]);
+            }
+        }
+        total += local;
+    });
+    return total;
+}
+
+namespace triangles {
+
+  // Triangles of each vertex, indexed by rank
+  inline std::vector<uint64_t> byRank(const OrientedAdjacency& oriented,
+                                      unsigned num_threads) {
+    size_t size = oriented.size();
+    const size_t* offsets = oriented.offsets.data();
+    const uint32_t* targets = oriented.targets.data();
+    std::vector<std::atomic<uint64_t>> counts(size);
+    for (std::atomic<uint64_t>& count : counts) {
+      count.store(0, std::memory_order_relaxed);
+    }
+    parallelForDynamic(0, size, num_threads, [&](unsigned, size_t lo, size_t hi) {
+      for (size_t u = lo; u < hi; u++) {
+        const uint32_t* row = targets + offsets[u];
+        size_t row_size = offsets[u + 1] - offsets[u];
+        uint64_t own = 0;
+        for (size_t e = 0; e < row_size; e++) {
+          uint32_t v = row[e];
+          uint64_t shared = 0;
+          intersect(row + e + 1, row_size - e - 1, targets + offsets[v],
+                    offsets[v + 1] - offsets[v], [&](uint32_t w) {
+            counts[w].fetch_add(1, std::memory_order_relaxed);
+            shared++;
+          });
+          if (shared > 0) {
+            counts[v].fetch_add(shared, std::memory_order_relaxed);
+            own += shared;
+          }
+        }
+        if (own > 0) {
+          counts[u].fetch_add(own, std::memory_order_relaxed);
+        }
+      }
+    });
+    std::vector<uint64_t> result(size);
+    for (size_t r = 0; r < size; r++) {
+      result[r] = counts[r].load(std::memory_order_relaxed);
+    }
+    return result;
+  }
+
+} // triangles namespace end
+
+template <typename T>
+std::vector<uint64_t> vertexTriangles(const AdjacencySnapshot<T>& graph,
+                                      unsigned num_threads) {
+    OrientedAdjacency oriented(graph);
+    std::vector<uint64_t> by_rank = triangles::byRank(oriented, num_threads);
+    std::vector<uint64_t> result(graph.size());
+    for (size_t r = 0; r < oriented.size(); r++) {
+        result[oriented.vertex_of_rank[r]] = by_rank[r];
+    }
+    return result;
+}
+
+template <typename T>
+std::vector<double> clusteringCoefficients(const AdjacencySnapshot<T>& graph,
+                                           unsigned num_threads) {
+    OrientedAdjacency oriented(graph);
+    std::vector<uint64_t> by_rank = triangles::byRank(oriented, num_threads);
+    std::vector<double> coefficients(graph.size(), 0);
+    for (size_t r = 0; r < oriented.size(); r++) {
+        double degree = oriented.degree[r];
+        if (degree >= 2) {
+            coefficients[oriented.vertex_of_rank[r]] =
+                2.0 * double(by_rank[r]) / (degree * (degree - 1));
+        }
+    }
+    return coefficients;
+}
+
+} // easy_graphs namespace end
+
+#endif // TRIANGLES_H